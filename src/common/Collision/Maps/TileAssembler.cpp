@@ -21,9 +21,13 @@
 #include "MapTree.h"
 #include "VMapDefinitions.h"
 #include <boost/filesystem.hpp>
+#include <algorithm>
+#include <atomic>
 #include <iomanip>
+#include <iterator>
 #include <set>
 #include <sstream>
+#include <thread>
 
 using G3D::Vector3;
 using G3D::AABox;
@@ -52,8 +56,51 @@ namespace VMAP
 
     //=================================================================
 
-    TileAssembler::TileAssembler(const std::string& pSrcDirName, const std::string& pDestDirName)
-        : iDestDir(pDestDirName), iSrcDir(pSrcDirName)
+    namespace
+    {
+        // runs job(0) .. job(count - 1) on up to <threads> threads, stops taking new jobs after the first failed one
+        template<class Job>
+        bool RunJobs(std::size_t count, uint32 threads, Job const& job)
+        {
+            std::atomic<std::size_t> nextJob = 0;
+            std::atomic<bool> success = true;
+
+            auto worker = [&]()
+            {
+                for (std::size_t i = nextJob++; i < count && success; i = nextJob++)
+                    if (!job(i))
+                        success = false;
+            };
+
+            threads = std::min<std::size_t>(std::max<uint32>(threads, 1), std::max<std::size_t>(count, 1));
+            if (threads == 1)
+            {
+                worker();
+                return success;
+            }
+
+            std::vector<std::thread> workers;
+            workers.reserve(threads);
+            for (uint32 i = 0; i < threads; ++i)
+                workers.emplace_back(worker);
+
+            for (std::thread& thread : workers)
+                thread.join();
+
+            return success;
+        }
+
+        struct TileJob
+        {
+            uint32 MapId;
+            MapSpawns const* Spawns;
+            TileMap::const_iterator Tile;
+            uint32 SpawnCount;
+        };
+    }
+
+    TileAssembler::TileAssembler(const std::string& pSrcDirName, const std::string& pDestDirName, uint32 threads)
+        : iDestDir(pDestDirName), iSrcDir(pSrcDirName), iThreads(std::max<uint32>(threads, 1))
     {
         boost::filesystem::create_directory(iDestDir);
         //init();
@@ -72,141 +119,115 @@ namespace VMAP
             return false;
         }
 
-        // export Map data
-        for (MapData::iterator map_iter = mapData.begin(); map_iter != mapData.end() && success; ++map_iter)
+        // M2 models don't have a bound set in WDT/ADT placement data, i still think they're not used for LoS at all on retail
+        // The bounds of all maps are calculated up front on all threads, raw models are read once and shared between spawns
+        printf("Calculating model bounds...\n");
+        std::vector<ModelSpawn const*> boundSpawns;
+        for (MapData::value_type const& map : mapData)
+            for (UniqueEntryMap::value_type const& entry : map.second->UniqueEntries)
+                if (entry.second.flags & MOD_M2)
+                    boundSpawns.push_back(&entry.second);
+
+        std::vector<G3D::AABox> bounds(boundSpawns.size());
+        std::unique_ptr<bool[]> boundCalculated(new bool[boundSpawns.size()]());
+        RunJobs(boundSpawns.size(), iThreads, [&](std::size_t i)
+        {
+            boundCalculated[i] = calculateTransformedBound(*boundSpawns[i], bounds[i]);
+            return true;
+        });
+
         {
-            // build global map tree
-            std::vector<ModelSpawn*> mapSpawns;
-            UniqueEntryMap::iterator entry;
-            printf("Calculating model bounds for map %u...\n", map_iter->first);
-            for (entry = map_iter->second->UniqueEntries.begin(); entry != map_iter->second->UniqueEntries.end(); ++entry)
+            std::lock_guard<std::mutex> guard(iModelVerticesLock);
+            iModelVertices.clear();
+        }
+
+        // apply them in spawn order, a map stops at its first model without bound like the spawns were processed one by one
+        std::vector<std::vector<ModelSpawn*>> mapSpawns;
+        std::size_t boundIndex = 0;
+        for (MapData::value_type& map : mapData)
+        {
+            std::vector<ModelSpawn*>& spawns = mapSpawns.emplace_back();
+            bool skipBounds = false;
+            for (UniqueEntryMap::value_type& entry : map.second->UniqueEntries)
             {
-                // M2 models don't have a bound set in WDT/ADT placement data, i still think they're not used for LoS at all on retail
-                if (entry->second.flags & MOD_M2)
+                if (entry.second.flags & MOD_M2)
                 {
-                    if (!calculateTransformedBound(entry->second))
+                    std::size_t const index = boundIndex++;
+                    if (skipBounds || !boundCalculated[index])
                     {
-                        break;
+                        skipBounds = true;
+                        continue;
                     }
+
+                    entry.second.iBound = bounds[index];
+                    entry.second.flags |= MOD_HAS_BOUND;
                 }
-                else if (entry->second.flags & MOD_WORLDSPAWN) // WMO maps and terrain maps use different origin, so we need to adapt :/
+                else if (skipBounds)
+                {
+                    continue;
+                }
+                else if (entry.second.flags & MOD_WORLDSPAWN) // WMO maps and terrain maps use different origin, so we need to adapt :/
                 {
                     /// @todo remove extractor hack and uncomment below line:
                     //entry->second.iPos += Vector3(533.33333f*32, 533.33333f*32, 0.f);
-                    entry->second.iBound = entry->second.iBound + Vector3(533.33333f * 32, 533.33333f * 32, 0.f);
+                    entry.second.iBound = entry.second.iBound + Vector3(533.33333f * 32, 533.33333f * 32, 0.f);
                 }
-                mapSpawns.push_back(&(entry->second));
-                spawnedModelFiles.insert(entry->second.name);
+                spawns.push_back(&entry.second);
+                spawnedModelFiles.insert(entry.second.name);
             }
+        }
 
-            printf("Creating map tree for map %u...\n", map_iter->first);
-            BIH pTree;
-
-            try
-            {
-                pTree.build(mapSpawns, BoundsTrait<ModelSpawn*>::GetBounds);
-            }
-            catch (std::exception& e)
-            {
-                printf("Exception ""%s"" when calling pTree.build", e.what());
-                return false;
-            }
-
-            // ===> possibly move this code to StaticMapTree class
-            std::map<uint32, uint32> modelNodeIdx;
-            for (uint32 i = 0; i < mapSpawns.size(); ++i)
-            {
-                modelNodeIdx.insert(pair<uint32, uint32>(mapSpawns[i]->ID, i));
-            }
-
-            // write map tree file
-            std::stringstream mapfilename;
-            mapfilename << iDestDir << '/' << std::setfill('0') << std::setw(3) << map_iter->first << ".vmtree";
-            FILE* mapfile = fopen(mapfilename.str().c_str(), "wb");
-            if (!mapfile)
-            {
-                success = false;
-                printf("Cannot open %s\n", mapfilename.str().c_str());
-                break;
-            }
-
-            //general info
-            if (success && fwrite(VMAP_MAGIC, 1, 8, mapfile) != 8) { success = false; }
-            uint32 globalTileID = StaticMapTree::packTileID(65, 65);
-            pair<TileMap::iterator, TileMap::iterator> globalRange = map_iter->second->TileEntries.equal_range(globalTileID);
-            char isTiled = globalRange.first == globalRange.second; // only maps without terrain (tiles) have global WMO
-            if (success && fwrite(&isTiled, sizeof(char), 1, mapfile) != 1) { success = false; }
-            // Nodes
-            if (success && fwrite("NODE", 4, 1, mapfile) != 1) { success = false; }
-            if (success) { success = pTree.writeToFile(mapfile); }
-            // global map spawns (WDT), if any (most instances)
-            if (success && fwrite("GOBJ", 4, 1, mapfile) != 1) { success = false; }
-
-            for (TileMap::iterator glob = globalRange.first; glob != globalRange.second && success; ++glob)
-            {
-                success = ModelSpawn::writeToFile(mapfile, map_iter->second->UniqueEntries[glob->second]);
-            }
-
-            fclose(mapfile);
-
-            // <====
+        // export Map data, map trees first and then the tile files of all maps
+        std::vector<std::pair<uint32, MapSpawns*>> maps(mapData.begin(), mapData.end());
+        success = RunJobs(maps.size(), iThreads, [&](std::size_t i)
+        {
+            return writeMapTree(maps[i].first, *maps[i].second, mapSpawns[i]);
+        });
 
-            // write map tile files, similar to ADT files, only with extra BSP tree node info
-            TileMap& tileEntries = map_iter->second->TileEntries;
-            TileMap::iterator tile;
-            for (tile = tileEntries.begin(); tile != tileEntries.end(); ++tile)
+        std::vector<TileJob> tileJobs;
+        for (MapData::value_type const& map : mapData)
+        {
+            TileMap const& tileEntries = map.second->TileEntries;
+            for (TileMap::const_iterator tile = tileEntries.begin(); tile != tileEntries.end(); ++tile)
             {
-                const ModelSpawn& spawn = map_iter->second->UniqueEntries[tile->second];
+                const ModelSpawn& spawn = map.second->UniqueEntries.at(tile->second);
                 if (spawn.flags & MOD_WORLDSPAWN) // WDT spawn, saved as tile 65/65 currently...
                 {
                     continue;
                 }
                 uint32 nSpawns = tileEntries.count(tile->first);
-                std::stringstream tilefilename;
-                tilefilename.fill('0');
-                tilefilename << iDestDir << '/' << std::setw(3) << map_iter->first << '_';
-                uint32 x, y;
-                StaticMapTree::unpackTileID(tile->first, x, y);
-                tilefilename << std::setw(2) << x << '_' << std::setw(2) << y << ".vmtile";
-                if (FILE* tilefile = fopen(tilefilename.str().c_str(), "wb"))
-                {
-                    // file header
-                    if (success && fwrite(VMAP_MAGIC, 1, 8, tilefile) != 8) { success = false; }
-                    // write number of tile spawns
-                    if (success && fwrite(&nSpawns, sizeof(uint32), 1, tilefile) != 1) { success = false; }
-                    // write tile spawns
-                    for (uint32 s = 0; s < nSpawns; ++s)
-                    {
-                        if (s)
-                        {
-                            ++tile;
-                        }
-                        const ModelSpawn& spawn2 = map_iter->second->UniqueEntries[tile->second];
-                        success = success && ModelSpawn::writeToFile(tilefile, spawn2);
-                        // MapTree nodes to update when loading tile:
-                        std::map<uint32, uint32>::iterator nIdx = modelNodeIdx.find(spawn2.ID);
-                        if (success && fwrite(&nIdx->second, sizeof(uint32), 1, tilefile) != 1) { success = false; }
-                    }
-                    fclose(tilefile);
-                }
+                tileJobs.push_back({ map.first, map.second, tile, nSpawns });
+                std::advance(tile, nSpawns - 1);
             }
-            // break; //test, extract only first map; TODO: remvoe this line
         }
 
+        success = success && RunJobs(tileJobs.size(), iThreads, [&](std::size_t i)
+        {
+            TileJob const& job = tileJobs[i];
+            return writeMapTile(job.MapId, *job.Spawns, job.Tile, job.SpawnCount);
+        });
+
         // add an object models, listed in temp_gameobject_models file
         exportGameobjectModels();
         // export objects
         std::cout << "\nConverting Model Files" << std::endl;
-        for (std::set<std::string>::iterator mfile = spawnedModelFiles.begin(); mfile != spawnedModelFiles.end(); ++mfile)
+        std::vector<std::string> modelFiles(spawnedModelFiles.begin(), spawnedModelFiles.end());
+        std::mutex outputLock;
+        success = success && RunJobs(modelFiles.size(), iThreads, [&](std::size_t i)
         {
-            std::cout << "Converting " << *mfile << std::endl;
-            if (!convertRawFile(*mfile))
             {
-                std::cout << "error converting " << *mfile << std::endl;
-                success = false;
-                break;
+                std::lock_guard<std::mutex> guard(outputLock);
+                std::cout << "Converting " << modelFiles[i] << std::endl;
             }
-        }
+
+            if (!convertRawFile(modelFiles[i]))
+            {
+                std::lock_guard<std::mutex> guard(outputLock);
+                std::cout << "error converting " << modelFiles[i] << std::endl;
+                return false;
+            }
+            return true;
+        });
 
         //cleanup:
         for (MapData::iterator map_iter = mapData.begin(); map_iter != mapData.end(); ++map_iter)
@@ -216,6 +237,97 @@ namespace VMAP
         return success;
     }
 
+    bool TileAssembler::writeMapTree(uint32 mapId, MapSpawns& spawns, std::vector<ModelSpawn*>& mapSpawns)
+    {
+        // build global map tree
+        printf("Creating map tree for map %u...\n", mapId);
+        BIH pTree;
+
+        try
+        {
+            pTree.build(mapSpawns, BoundsTrait<ModelSpawn*>::GetBounds);
+        }
+        catch (std::exception& e)
+        {
+            printf("Exception ""%s"" when calling pTree.build", e.what());
+            return false;
+        }
+
+        // ===> possibly move this code to StaticMapTree class
+        for (uint32 i = 0; i < mapSpawns.size(); ++i)
+        {
+            spawns.ModelNodeIdx.insert(pair<uint32, uint32>(mapSpawns[i]->ID, i));
+        }
+
+        // write map tree file
+        std::stringstream mapfilename;
+        mapfilename << iDestDir << '/' << std::setfill('0') << std::setw(3) << mapId << ".vmtree";
+        FILE* mapfile = fopen(mapfilename.str().c_str(), "wb");
+        if (!mapfile)
+        {
+            printf("Cannot open %s\n", mapfilename.str().c_str());
+            return false;
+        }
+
+        //general info
+        bool success = fwrite(VMAP_MAGIC, 1, 8, mapfile) == 8;
+        uint32 globalTileID = StaticMapTree::packTileID(65, 65);
+        pair<TileMap::const_iterator, TileMap::const_iterator> globalRange = spawns.TileEntries.equal_range(globalTileID);
+        char isTiled = globalRange.first == globalRange.second; // only maps without terrain (tiles) have global WMO
+        if (success && fwrite(&isTiled, sizeof(char), 1, mapfile) != 1) { success = false; }
+        // Nodes
+        if (success && fwrite("NODE", 4, 1, mapfile) != 1) { success = false; }
+        if (success) { success = pTree.writeToFile(mapfile); }
+        // global map spawns (WDT), if any (most instances)
+        if (success && fwrite("GOBJ", 4, 1, mapfile) != 1) { success = false; }
+
+        for (TileMap::const_iterator glob = globalRange.first; glob != globalRange.second && success; ++glob)
+        {
+            success = ModelSpawn::writeToFile(mapfile, spawns.UniqueEntries.at(glob->second));
+        }
+
+        fclose(mapfile);
+
+        // <====
+        return success;
+    }
+
+    bool TileAssembler::writeMapTile(uint32 mapId, MapSpawns const& spawns, TileMap::const_iterator tile, uint32 nSpawns)
+    {
+        // write map tile files, similar to ADT files, only with extra BSP tree node info
+        std::stringstream tilefilename;
+        tilefilename.fill('0');
+        tilefilename << iDestDir << '/' << std::setw(3) << mapId << '_';
+        uint32 x, y;
+        StaticMapTree::unpackTileID(tile->first, x, y);
+        tilefilename << std::setw(2) << x << '_' << std::setw(2) << y << ".vmtile";
+        FILE* tilefile = fopen(tilefilename.str().c_str(), "wb");
+        if (!tilefile)
+        {
+            return true;
+        }
+
+        // file header
+        bool success = fwrite(VMAP_MAGIC, 1, 8, tilefile) == 8;
+        // write number of tile spawns
+        if (success && fwrite(&nSpawns, sizeof(uint32), 1, tilefile) != 1) { success = false; }
+        // write tile spawns
+        for (uint32 s = 0; s < nSpawns; ++s)
+        {
+            if (s)
+            {
+                ++tile;
+            }
+            const ModelSpawn& spawn2 = spawns.UniqueEntries.at(tile->second);
+            success = success && ModelSpawn::writeToFile(tilefile, spawn2);
+            // MapTree nodes to update when loading tile:
+            std::map<uint32, uint32>::const_iterator nIdx = spawns.ModelNodeIdx.find(spawn2.ID);
+            if (success && fwrite(&nIdx->second, sizeof(uint32), 1, tilefile) != 1) { success = false; }
+        }
+        fclose(tilefile);
+        return success;
+    }
+
     bool TileAssembler::readMapSpawns()
     {
         std::string fname = iSrcDir + "/dir_bin";
@@ -264,59 +376,91 @@ namespace VMAP
         return success;
     }
 
-    bool TileAssembler::calculateTransformedBound(ModelSpawn& spawn)
+    ModelVertices TileAssembler::getModelVertices(std::string const& name)
     {
+        {
+            std::lock_guard<std::mutex> guard(iModelVerticesLock);
+            auto itr = iModelVertices.find(name);
+            if (itr != iModelVertices.end())
+                return itr->second;
+        }
+
         std::string modelFilename(iSrcDir);
         modelFilename.push_back('/');
-        modelFilename.append(spawn.name);
-
-        ModelPosition modelPosition;
-        modelPosition.iDir = spawn.iRot;
-        modelPosition.iScale = spawn.iScale;
-        modelPosition.init();
+        modelFilename.append(name);
 
+        std::shared_ptr<std::vector<Vector3>> vertices;
         WorldModel_Raw raw_model;
-        if (!raw_model.Read(modelFilename.c_str()))
+        if (raw_model.Read(modelFilename.c_str()))
+        {
+            uint32 groups = raw_model.groupsArray.size();
+            if (groups != 1)
+            {
+                printf("Warning: '%s' does not seem to be a M2 model!\n", modelFilename.c_str());
+            }
+
+            vertices = std::make_shared<std::vector<Vector3>>();
+            for (uint32 g = 0; g < groups; ++g) // should be only one for M2 files...
+            {
+                std::vector<Vector3>& groupVertices = raw_model.groupsArray[g].vertexArray;
+                if (groupVertices.empty())
+                {
+                    std::cout << "error: model '" << name << "' has no geometry!" << std::endl;
+                    continue;
+                }
+
+                vertices->insert(vertices->end(), groupVertices.begin(), groupVertices.end());
+            }
+        }
+
+        // models failing to load are cached too, as nullptr
+        std::lock_guard<std::mutex> guard(iModelVerticesLock);
+        return iModelVertices.emplace(name, std::move(vertices)).first->second;
+    }
+
+    bool TileAssembler::calculateTransformedBound(ModelSpawn& spawn)
+    {
+        G3D::AABox bound;
+        if (!calculateTransformedBound(spawn, bound))
         {
             return false;
         }
 
-        uint32 groups = raw_model.groupsArray.size();
-        if (groups != 1)
+        spawn.iBound = bound;
+        spawn.flags |= MOD_HAS_BOUND;
+        return true;
+    }
+
+    bool TileAssembler::calculateTransformedBound(ModelSpawn const& spawn, G3D::AABox& bound)
+    {
+        ModelVertices vertices = getModelVertices(spawn.name);
+        if (!vertices)
         {
-            printf("Warning: '%s' does not seem to be a M2 model!\n", modelFilename.c_str());
+            return false;
         }
 
+        ModelPosition modelPosition;
+        modelPosition.iDir = spawn.iRot;
+        modelPosition.iScale = spawn.iScale;
+        modelPosition.init();
+
         AABox modelBound;
         bool boundEmpty = true;
 
-        for (uint32 g = 0; g < groups; ++g) // should be only one for M2 files...
+        for (Vector3 const& vertex : *vertices)
         {
-            std::vector<Vector3>& vertices = raw_model.groupsArray[g].vertexArray;
+            Vector3 v = modelPosition.transform(vertex);
 
-            if (vertices.empty())
+            if (boundEmpty)
             {
-                std::cout << "error: model '" << spawn.name << "' has no geometry!" << std::endl;
-                continue;
+                modelBound = AABox(v, v), boundEmpty = false;
             }
-
-            uint32 nvectors = vertices.size();
-            for (uint32 i = 0; i < nvectors; ++i)
+            else
             {
-                Vector3 v = modelPosition.transform(vertices[i]);
-
-                if (boundEmpty)
-                {
-                    modelBound = AABox(v, v), boundEmpty = false;
-                }
-                else
-                {
-                    modelBound.merge(v);
-                }
+                modelBound.merge(v);
             }
         }
-        spawn.iBound = modelBound + spawn.iPos;
-        spawn.flags |= MOD_HAS_BOUND;
+        bound = modelBound + spawn.iPos;
         return true;
     }
 
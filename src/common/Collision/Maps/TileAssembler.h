@@ -21,7 +21,10 @@
 #include <G3D/Matrix3.h>
 #include <G3D/Vector3.h>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <set>
+#include <unordered_map>
 
 #include "ModelInstance.h"
 #include "WorldModel.h"
@@ -58,6 +61,7 @@ namespace VMAP
     {
         UniqueEntryMap UniqueEntries;
         TileMap TileEntries;
+        std::map<uint32, uint32> ModelNodeIdx;              // spawn id -> index in the map tree
     };
 
     typedef std::map<uint32, MapSpawns*> MapData;
@@ -89,17 +93,29 @@ namespace VMAP
         bool Read(const char* path);
     };
 
+    typedef std::shared_ptr<std::vector<G3D::Vector3> const> ModelVertices;
+
     class TileAssembler
     {
     private:
         std::string iDestDir;
         std::string iSrcDir;
+        uint32 iThreads;
         G3D::Table<std::string, unsigned int > iUniqueNameIds;
         MapData mapData;
         std::set<std::string> spawnedModelFiles;
 
+        // vertices of the raw models used by M2 spawns, shared by all threads calculating bounds
+        std::mutex iModelVerticesLock;
+        std::unordered_map<std::string, ModelVertices> iModelVertices;
+
+        ModelVertices getModelVertices(std::string const& name);
+        bool calculateTransformedBound(ModelSpawn const& spawn, G3D::AABox& bound);
+        bool writeMapTree(uint32 mapId, MapSpawns& spawns, std::vector<ModelSpawn*>& mapSpawns);
+        bool writeMapTile(uint32 mapId, MapSpawns const& spawns, TileMap::const_iterator tile, uint32 nSpawns);
+
     public:
-        TileAssembler(const std::string& pSrcDirName, const std::string& pDestDirName);
+        TileAssembler(const std::string& pSrcDirName, const std::string& pDestDirName, uint32 threads = 1);
         virtual ~TileAssembler();
 
         bool convertWorld2();
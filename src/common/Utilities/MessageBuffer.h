@@ -37,6 +37,9 @@ public:
         _storage.resize(initialSize);
     }
 
+    // takes over already written data, without copying it
+    explicit MessageBuffer(std::vector<uint8>&& data) : _wpos(data.size()), _rpos(0), _storage(std::move(data)) { }
+
     MessageBuffer(MessageBuffer const& right) :
         _wpos(right._wpos), _rpos(right._rpos), _storage(right._storage) { }
 
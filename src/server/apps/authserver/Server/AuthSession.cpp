@@ -174,7 +174,7 @@ void AuthSession::Start()
     LoginDatabasePreparedStatement* stmt = LoginDatabase.GetPreparedStatement(LOGIN_SEL_IP_INFO);
     stmt->SetData(0, ip_address);
 
-    _queryProcessor.AddCallback(LoginDatabase.AsyncQuery(stmt).WithPreparedCallback(std::bind(&AuthSession::CheckIpCallback, this, std::placeholders::_1)));
+    AddQueryCallback(LoginDatabase.AsyncQuery(stmt).WithPreparedCallback(std::bind(&AuthSession::CheckIpCallback, this, std::placeholders::_1)));
 }
 
 bool AuthSession::Update()
@@ -183,10 +183,19 @@ bool AuthSession::Update()
         return false;
 
     _queryProcessor.ProcessReadyCallbacks();
+    if (!_queryProcessor.Empty())
+        QueueDelayedUpdate(SOCKET_CALLBACK_POLL_INTERVAL);
 
     return true;
 }
 
+void AuthSession::AddQueryCallback(QueryCallback&& callback)
+{
+    // the periodic sweep skips open sockets, poll until the database has answered
+    _queryProcessor.AddCallback(std::move(callback));
+    QueueDelayedUpdate(SOCKET_CALLBACK_POLL_INTERVAL);
+}
+
 void AuthSession::CheckIpCallback(PreparedQueryResult result)
 {
     if (result)
@@ -278,6 +287,7 @@ void AuthSession::SendPacket(ByteBuffer& packet)
         MessageBuffer buffer(packet.size());
         buffer.Write(packet.contents(), packet.size());
         QueuePacket(std::move(buffer));
+        QueueUpdate();
     }
 }
 
@@ -311,7 +321,7 @@ bool AuthSession::HandleLogonChallenge()
     stmt->SetData(0, GetRemoteIpAddress().to_string());
     stmt->SetData(1, login);
 
-    _queryProcessor.AddCallback(LoginDatabase.AsyncQuery(stmt).WithPreparedCallback(std::bind(&AuthSession::LogonChallengeCallback, this, std::placeholders::_1)));
+    AddQueryCallback(LoginDatabase.AsyncQuery(stmt).WithPreparedCallback(std::bind(&AuthSession::LogonChallengeCallback, this, std::placeholders::_1)));
     return true;
 }
 
@@ -521,7 +531,7 @@ bool AuthSession::HandleLogonProof()
         stmt->SetData(2, GetLocaleByName(_localizationName));
         stmt->SetData(3, _os);
         stmt->SetData(4, _accountInfo.Login);
-        _queryProcessor.AddCallback(LoginDatabase.AsyncQuery(stmt)
+        AddQueryCallback(LoginDatabase.AsyncQuery(stmt)
             .WithPreparedCallback([this, M2 = Acore::Crypto::SRP6::GetSessionVerifier(logonProof->A, logonProof->clientM, _sessionKey)](PreparedQueryResult const&)
         {
             // Finish SRP6 and send the final result to the client
@@ -649,7 +659,7 @@ bool AuthSession::HandleReconnectChallenge()
     stmt->SetData(0, GetRemoteIpAddress().to_string());
     stmt->SetData(1, login);
 
-    _queryProcessor.AddCallback(LoginDatabase.AsyncQuery(stmt).WithPreparedCallback(std::bind(&AuthSession::ReconnectChallengeCallback, this, std::placeholders::_1)));
+    AddQueryCallback(LoginDatabase.AsyncQuery(stmt).WithPreparedCallback(std::bind(&AuthSession::ReconnectChallengeCallback, this, std::placeholders::_1)));
     return true;
 }
 
@@ -731,7 +741,7 @@ bool AuthSession::HandleRealmList()
     LoginDatabasePreparedStatement* stmt = LoginDatabase.GetPreparedStatement(LOGIN_SEL_REALM_CHARACTER_COUNTS);
     stmt->SetData(0, _accountInfo.Id);
 
-    _queryProcessor.AddCallback(LoginDatabase.AsyncQuery(stmt).WithPreparedCallback(std::bind(&AuthSession::RealmListCallback, this, std::placeholders::_1)));
+    AddQueryCallback(LoginDatabase.AsyncQuery(stmt).WithPreparedCallback(std::bind(&AuthSession::RealmListCallback, this, std::placeholders::_1)));
     _status = STATUS_WAITING_FOR_REALM_LIST;
     return true;
 }
@@ -85,6 +85,7 @@ private:
     bool HandleReconnectProof();
     bool HandleRealmList();
 
+    void AddQueryCallback(QueryCallback&& callback);
     void CheckIpCallback(PreparedQueryResult result);
     void LogonChallengeCallback(PreparedQueryResult result);
     void ReconnectChallengeCallback(PreparedQueryResult result);
@@ -75,6 +75,7 @@ DatabaseLoader& DatabaseLoader::AddDatabase(DatabaseWorkerPool<T>& pool, std::st
         uint8 const synchThreads = sConfigMgr->GetOption<uint8>(name + "Database.SynchThreads", 1);
 
         pool.SetConnectionInfo(dbString, asyncThreads, synchThreads);
+        pool.SetQueryHolderParallelism(sConfigMgr->GetOption<uint8>(name + "Database.QueryHolderParallelism", 1));
 
         if (uint32 error = pool.Open())
         {
@@ -31,6 +31,7 @@
 #include "SQLOperation.h"
 #include "Transaction.h"
 #include "WorldDatabase.h"
+#include <algorithm>
 #include <limits>
 #include <mysqld_error.h>
 #include <sstream>
@@ -55,7 +56,8 @@ template <class T>
 DatabaseWorkerPool<T>::DatabaseWorkerPool() :
     _queue(new ProducerConsumerQueue<SQLOperation*>()),
     _async_threads(0),
-    _synch_threads(0)
+    _synch_threads(0),
+    _queryHolderParallelism(1)
 {
     WPFatal(mysql_thread_safe(), "Used MySQL library isn't thread-safe.");
 
@@ -236,10 +238,26 @@ QueryCallback DatabaseWorkerPool<T>::AsyncQuery(PreparedStatement<T>* stmt)
 template <class T>
 SQLQueryHolderCallback DatabaseWorkerPool<T>::DelayQueryHolder(std::shared_ptr<SQLQueryHolder<T>> holder)
 {
-    SQLQueryHolderTask* task = new SQLQueryHolderTask(holder);
-    // Store future result before enqueueing - task might get already processed and deleted before returning from this method
-    QueryResultHolderFuture result = task->GetFuture();
-    Enqueue(task);
+    // Splitting tiny holders costs more in queue traffic than it saves in round-trips
+    constexpr std::size_t MIN_QUERIES_PER_PART = 4;
+
+    std::size_t const size = holder->GetSize();
+    std::size_t parts = std::min<std::size_t>(std::min(_queryHolderParallelism, _async_threads), size / MIN_QUERIES_PER_PART);
+    if (parts < 1)
+        parts = 1;
+
+    auto state = std::make_shared<SQLQueryHolderState>(parts, GetDatabaseName());
+    // Store future result before enqueueing - tasks might get already processed and deleted before returning from this method
+    QueryResultHolderFuture result = state->Result.get_future();
+
+    std::size_t begin = 0;
+    for (std::size_t i = 0; i < parts; ++i)
+    {
+        std::size_t const end = begin + (size - begin) / (parts - i);
+        Enqueue(new SQLQueryHolderTask(holder, state, begin, end));
+        begin = end;
+    }
+
     return { std::move(holder), std::move(result) };
 }
 
@@ -62,6 +62,10 @@ public:
 
     void SetConnectionInfo(std::string_view infoString, uint8 const asyncThreads, uint8 const synchThreads);
 
+    //! Sets the maximum number of async connections a single query holder may be split over.
+    //! Capped by the number of async connections, 1 keeps holders on a single connection.
+    void SetQueryHolderParallelism(uint8 const parallelism) { _queryHolderParallelism = parallelism; }
+
     uint32 Open();
     void Close();
 
@@ -157,7 +161,8 @@ public:
     QueryCallback AsyncQuery(PreparedStatement<T>* stmt);
 
     //! Enqueues a vector of SQL operations (can be both adhoc and prepared) that will set the value of the QueryResultHolderFuture
-    //! return object as soon as the query is executed.
+    //! return object as soon as all queries are executed.
+    //! Large holders are split in contiguous parts executed concurrently by up to SetQueryHolderParallelism async connections.
     //! The return value is then processed in ProcessQueryCallback methods.
     //! Any prepared statements added to this holder need to be prepared with the CONNECTION_ASYNC flag.
     SQLQueryHolderCallback DelayQueryHolder(std::shared_ptr<SQLQueryHolder<T>> holder);
@@ -234,6 +239,7 @@ private:
     std::unique_ptr<MySQLConnectionInfo> _connectionInfo;
     std::vector<uint8> _preparedStatementSize;
     uint8 _async_threads, _synch_threads;
+    uint8 _queryHolderParallelism;
 #ifdef ACORE_DEBUG
     static inline thread_local bool _warnSyncQueries = false;
 #endif
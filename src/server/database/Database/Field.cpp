@@ -20,6 +20,7 @@
 #include "Log.h"
 #include "MySQLHacks.h"
 #include "StringConvert.h"
+#include <charconv>
 
 Field::Field()
 {
@@ -141,6 +142,46 @@ namespace
 
         return false;
     }
+
+    // same value as StringTo<float>, without its string copy where the standard library parses floating point values
+    inline Optional<float> ParseFloat(std::string_view str)
+    {
+#ifdef __cpp_lib_to_chars
+        float value;
+        std::from_chars_result const res = std::from_chars(str.data(), str.data() + str.length(), value);
+        if (res.ec == std::errc() && res.ptr == str.data() + str.length())
+            return value;
+#endif
+
+        // leading spaces, hexadecimal values...
+        return Acore::StringTo<float>(str);
+    }
+
+    // true if Get<T>() on fields of this column does more than converting the value, see Field::GetData
+    template<typename T>
+    inline bool NeedsFieldChecks([[maybe_unused]] QueryResultFieldMetadata const& meta)
+    {
+#ifdef ACORE_STRICT_DATABASE_TYPE_CHECKS
+        return true;
+#else
+        if constexpr (std::is_arithmetic_v<T>)
+        {
+            // aggregate functions
+            if (GetCleanAliasName(meta.Alias))
+                return true;
+
+            // -1 in *_dbc tables
+            if constexpr (std::is_same_v<T, uint32>)
+            {
+                std::string_view tableName{ meta.TableName };
+                if (tableName.size() > 4 && tableName.substr(tableName.length() - 4) == "_dbc")
+                    return true;
+            }
+        }
+
+        return false;
+#endif
+    }
 }
 
 void Field::GetBinarySizeChecked(uint8* buf, std::size_t length) const
@@ -286,6 +327,67 @@ template int64 Field::GetData() const;
 template float Field::GetData() const;
 template double Field::GetData() const;
 
+template<typename T>
+void Field::GetColumn(Field const* first, std::size_t stride, std::size_t count, T* out)
+{
+    if (!count)
+        return;
+
+    if constexpr (std::is_arithmetic_v<T>)
+    {
+        if (!NeedsFieldChecks<T>(*first->meta))
+        {
+            // same conversions as GetData, decimals are read as float there too
+            bool const fromString = std::is_same_v<T, double> && first->IsType(DatabaseFieldTypes::Decimal);
+
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                Field const& field = first[i * stride];
+                if (!field.data.value)
+                {
+                    out[i] = GetDefaultValue<T>();
+                    continue;
+                }
+
+                if (field.data.raw && !fromString)
+                {
+                    out[i] = *reinterpret_cast<T const*>(field.data.value);
+                    continue;
+                }
+
+                Optional<T> result;
+                if constexpr (std::is_floating_point_v<T>)
+                    result = ParseFloat(std::string_view(field.data.value, field.data.length));
+                else
+                    result = Acore::StringTo<T>(std::string_view(field.data.value, field.data.length));
+
+                // let GetData report the incorrect value
+                out[i] = result ? *result : field.GetData<T>();
+            }
+
+            return;
+        }
+    }
+
+    for (std::size_t i = 0; i < count; ++i)
+        out[i] = first[i * stride].Get<T>();
+}
+
+template void Field::GetColumn(Field const*, std::size_t, std::size_t, bool*);
+template void Field::GetColumn(Field const*, std::size_t, std::size_t, uint8*);
+template void Field::GetColumn(Field const*, std::size_t, std::size_t, uint16*);
+template void Field::GetColumn(Field const*, std::size_t, std::size_t, uint32*);
+template void Field::GetColumn(Field const*, std::size_t, std::size_t, uint64*);
+template void Field::GetColumn(Field const*, std::size_t, std::size_t, int8*);
+template void Field::GetColumn(Field const*, std::size_t, std::size_t, int16*);
+template void Field::GetColumn(Field const*, std::size_t, std::size_t, int32*);
+template void Field::GetColumn(Field const*, std::size_t, std::size_t, int64*);
+template void Field::GetColumn(Field const*, std::size_t, std::size_t, float*);
+template void Field::GetColumn(Field const*, std::size_t, std::size_t, double*);
+template void Field::GetColumn(Field const*, std::size_t, std::size_t, std::string*);
+template void Field::GetColumn(Field const*, std::size_t, std::size_t, std::string_view*);
+template void Field::GetColumn(Field const*, std::size_t, std::size_t, Binary*);
+
 std::string Field::GetDataString() const
 {
     if (!data.value)
@@ -148,6 +148,14 @@ public:
 
     DatabaseFieldTypes GetType() { return meta->Type; }
 
+    /**
+        Decodes the same column of count rows into out, the field of row i being first[i * stride].
+        Gives the same values as calling Get<T>() on every field, but the alias and table checks
+        of Get<T>() only depend on the column and are done once instead of for every row.
+    */
+    template<typename T>
+    static void GetColumn(Field const* first, std::size_t stride, std::size_t count, T* out);
+
 protected:
     struct
     {
@@ -158,6 +166,7 @@ protected:
 
     void SetByteValue(char const* newValue, uint32 length);
     void SetStructuredValue(char const* newValue, uint32 length);
+    void SetMetadata(QueryResultFieldMetadata const* fieldMeta);
     [[nodiscard]] bool IsType(DatabaseFieldTypes type) const;
     [[nodiscard]] bool IsNumeric() const;
 
@@ -171,7 +180,6 @@ private:
 
     QueryResultFieldMetadata const* meta;
     void LogWrongType(std::string_view getter, std::string_view typeName) const;
-    void SetMetadata(QueryResultFieldMetadata const* fieldMeta);
     void GetBinarySizeChecked(uint8* buf, std::size_t size) const;
 };
 
@@ -18,6 +18,7 @@
 #include "QueryHolder.h"
 #include "Errors.h"
 #include "Log.h"
+#include "Metric.h"
 #include "MySQLConnection.h"
 #include "PreparedStatement.h"
 #include "QueryResult.h"
@@ -76,12 +77,23 @@ SQLQueryHolderTask::~SQLQueryHolderTask() = default;
 
 bool SQLQueryHolderTask::Execute()
 {
-    /// execute all queries in the holder and pass the results
-    for (std::size_t i = 0; i < m_holder->m_queries.size(); ++i)
+    /// execute our part of the queries in the holder and pass the results
+    /// each part writes to its own slots, the vector itself is never resized while in flight
+    for (std::size_t i = m_begin; i < m_end; ++i)
         if (PreparedStatementBase* stmt = m_holder->m_queries[i].first)
             m_holder->SetPreparedResult(i, m_conn->Query(stmt));
 
-    m_result.set_value();
+    /// the last part to finish completes the holder
+    if (m_state->PendingParts.fetch_sub(1, std::memory_order_acq_rel) == 1)
+    {
+        METRIC_VALUE("db_query_holder_time",
+            int64(std::chrono::duration_cast<Milliseconds>(std::chrono::steady_clock::now() - m_state->StartTime).count()),
+            METRIC_TAG("database", std::string(m_state->DatabaseName)),
+            METRIC_TAG("parts", std::to_string(m_state->Parts)));
+
+        m_state->Result.set_value();
+    }
+
     return true;
 }
 
@@ -18,7 +18,9 @@
 #ifndef _QUERYHOLDER_H
 #define _QUERYHOLDER_H
 
+#include "Duration.h"
 #include "SQLOperation.h"
+#include <atomic>
 #include <vector>
 
 class AC_DATABASE_API SQLQueryHolderBase
@@ -29,6 +31,7 @@ public:
     SQLQueryHolderBase() = default;
     virtual ~SQLQueryHolderBase();
     void SetSize(std::size_t size);
+    [[nodiscard]] std::size_t GetSize() const { return m_queries.size(); }
     PreparedQueryResult GetPreparedResult(std::size_t index) const;
     void SetPreparedResult(std::size_t index, PreparedResultSet* result);
 
@@ -49,20 +52,38 @@ public:
     }
 };
 
+//! Completion state shared by all tasks executing parts of the same holder.
+//! The holder future is fulfilled by whichever part finishes last.
+struct SQLQueryHolderState
+{
+    SQLQueryHolderState(std::size_t parts, std::string_view databaseName)
+        : PendingParts(parts), Parts(parts), DatabaseName(databaseName), StartTime(std::chrono::steady_clock::now()) { }
+
+    std::atomic<std::size_t> PendingParts;
+    std::size_t const Parts;
+    std::string_view DatabaseName;
+    TimePoint const StartTime;
+    QueryResultHolderPromise Result;
+};
+
 class AC_DATABASE_API SQLQueryHolderTask : public SQLOperation
 {
 public:
-    explicit SQLQueryHolderTask(std::shared_ptr<SQLQueryHolderBase> holder)
-        : m_holder(std::move(holder)) { }
+    //! Executes only the queries in [begin, end) of the holder, so that one holder can be split
+    //! over several async connections. All parts of a holder must share the same state.
+    SQLQueryHolderTask(std::shared_ptr<SQLQueryHolderBase> holder, std::shared_ptr<SQLQueryHolderState> state, std::size_t begin, std::size_t end)
+        : m_holder(std::move(holder)), m_state(std::move(state)), m_begin(begin), m_end(end) { }
 
     ~SQLQueryHolderTask();
 
     bool Execute() override;
-    QueryResultHolderFuture GetFuture() { return m_result.get_future(); }
+    QueryResultHolderFuture GetFuture() { return m_state->Result.get_future(); }
 
 private:
     std::shared_ptr<SQLQueryHolderBase> m_holder;
-    QueryResultHolderPromise m_result;
+    std::shared_ptr<SQLQueryHolderState> m_state;
+    std::size_t m_begin;
+    std::size_t m_end;
 };
 
 class AC_DATABASE_API SQLQueryHolderCallback
@@ -180,6 +180,19 @@ ResultSet::ResultSet(MySQLResult* result, MySQLField* fields, uint64 rowCount, u
     }
 }
 
+ResultSet::ResultSet(std::vector<QueryResultFieldMetadata> fieldMetadata, uint64 rowCount) :
+    _fieldMetadata(std::move(fieldMetadata)),
+    _rowCount(rowCount),
+    _fieldCount(uint32(_fieldMetadata.size())),
+    _result(nullptr),
+    _fields(nullptr)
+{
+    _currentRow = new Field[_fieldCount];
+
+    for (uint32 i = 0; i < _fieldCount; i++)
+        _currentRow[i].SetMetadata(&_fieldMetadata[i]);
+}
+
 ResultSet::~ResultSet()
 {
     CleanUp();
@@ -187,32 +200,81 @@ ResultSet::~ResultSet()
 
 bool ResultSet::NextRow()
 {
-    MYSQL_ROW row;
+    char** values;
+    unsigned long* lengths;
 
-    if (!_result)
+    if (!_currentRow)
         return false;
 
-    row = mysql_fetch_row(_result);
-    if (!row)
+    if (!ReadRow(values, lengths))
     {
         CleanUp();
         return false;
     }
 
-    unsigned long* lengths = mysql_fetch_lengths(_result);
+    for (uint32 i = 0; i < _fieldCount; i++)
+        _currentRow[i].SetStructuredValue(values[i], lengths[i]);
+
+    return true;
+}
+
+bool ResultSet::ReadRow(char**& values, unsigned long*& lengths)
+{
+    if (!_result)
+        return false;
+
+    MYSQL_ROW row = mysql_fetch_row(_result);
+    if (!row)
+        return false;
+
+    lengths = mysql_fetch_lengths(_result);
     if (!lengths)
     {
         LOG_WARN("sql.sql", "{}:mysql_fetch_lengths, cannot retrieve value lengths. Error {}.", __FUNCTION__, mysql_error(_result->handle));
-        CleanUp();
         return false;
     }
 
-    for (uint32 i = 0; i < _fieldCount; i++)
-        _currentRow[i].SetStructuredValue(row[i], lengths[i]);
-
+    values = row;
     return true;
 }
 
+void ResultSet::FreeResult()
+{
+    if (_result)
+    {
+        mysql_free_result(_result);
+        _result = nullptr;
+    }
+}
+
+std::size_t ResultSet::NextRowBatch(Field* rows, std::size_t maxRows)
+{
+    // all rows were returned by the previous batch, the result stays until the destructor as its fields point into it
+    if (!_currentRow)
+        return 0;
+
+    std::size_t rowCount = 0;
+    while (rowCount < maxRows)
+    {
+        std::copy_n(_currentRow, _fieldCount, rows + rowCount * _fieldCount);
+        ++rowCount;
+
+        char** values;
+        unsigned long* lengths;
+        if (!ReadRow(values, lengths))
+        {
+            delete[] _currentRow;
+            _currentRow = nullptr;
+            break;
+        }
+
+        for (uint32 i = 0; i < _fieldCount; i++)
+            _currentRow[i].SetStructuredValue(values[i], lengths[i]);
+    }
+
+    return rowCount;
+}
+
 std::string ResultSet::GetFieldName(uint32 index) const
 {
     ASSERT(index < _fieldCount);
@@ -227,11 +289,7 @@ void ResultSet::CleanUp()
         _currentRow = nullptr;
     }
 
-    if (_result)
-    {
-        mysql_free_result(_result);
-        _result = nullptr;
-    }
+    FreeResult();
 }
 
 Field const& ResultSet::operator[](std::size_t index) const
@@ -246,6 +304,7 @@ void ResultSet::AssertRows(std::size_t sizeRows)
 }
 
 PreparedResultSet::PreparedResultSet(MySQLStmt* stmt, MySQLResult* result, uint64 rowCount, uint32 fieldCount) :
+    m_rowSize(0),
     m_rowCount(rowCount),
     m_rowPosition(0),
     m_fieldCount(fieldCount),
@@ -324,48 +383,20 @@ PreparedResultSet::PreparedResultSet(MySQLStmt* stmt, MySQLResult* result, uint6
         return;
     }
 
-    m_rows.resize(uint32(m_rowCount) * m_fieldCount);
+    // This runs on the thread owning the connection, only the lengths of the fetched values are kept here.
+    // Fields are set up by the thread reading the result, one row at a time, see SetRowFields.
+    m_rowSize = rowSize;
+    m_fieldLengths.resize(std::size_t(m_rowCount) * m_fieldCount);
 
     while (_NextRow())
     {
+        uint32* lengths = &m_fieldLengths[std::size_t(m_rowPosition) * m_fieldCount];
         for (uint32 fIndex = 0; fIndex < m_fieldCount; ++fIndex)
         {
-            m_rows[uint32(m_rowPosition) * m_fieldCount + fIndex].SetMetadata(&m_fieldMetadata[fIndex]);
-
-            unsigned long buffer_length = m_rBind[fIndex].buffer_length;
-            unsigned long fetched_length = *m_rBind[fIndex].length;
-            if (!*m_rBind[fIndex].is_null)
-            {
-                void* buffer = m_stmt->bind[fIndex].buffer;
-                switch (m_rBind[fIndex].buffer_type)
-                {
-                case MYSQL_TYPE_TINY_BLOB:
-                case MYSQL_TYPE_MEDIUM_BLOB:
-                case MYSQL_TYPE_LONG_BLOB:
-                case MYSQL_TYPE_BLOB:
-                case MYSQL_TYPE_STRING:
-                case MYSQL_TYPE_VAR_STRING:
-                    // warning - the string will not be null-terminated if there is no space for it in the buffer
-                    // when mysql_stmt_fetch returned MYSQL_DATA_TRUNCATED
-                    // we cannot blindly null-terminate the data either as it may be retrieved as binary blob and not specifically a string
-                    // in this case using Field::GetCString will result in garbage
-                    /// @todo: remove Field::GetCString and use std::string_view in C++17
-                    if (fetched_length < buffer_length)
-                        *((char*)buffer + fetched_length) = '\0';
-                    break;
-                default:
-                    break;
-                }
-
-                m_rows[uint32(m_rowPosition) * m_fieldCount + fIndex].SetByteValue((char const*)buffer, fetched_length);
-
-                // move buffer pointer to next part
-                m_stmt->bind[fIndex].buffer = (char*)buffer + rowSize;
-            }
-            else
-            {
-                m_rows[uint32(m_rowPosition) * m_fieldCount + fIndex].SetByteValue(nullptr, *m_rBind[fIndex].length);
-            }
+            lengths[fIndex] = *m_rBind[fIndex].is_null ? NullFieldLength : uint32(*m_rBind[fIndex].length);
+
+            // move buffer pointer to next part
+            m_stmt->bind[fIndex].buffer = (char*)m_stmt->bind[fIndex].buffer + rowSize;
         }
 
         m_rowPosition++;
@@ -375,6 +406,57 @@ PreparedResultSet::PreparedResultSet(MySQLStmt* stmt, MySQLResult* result, uint6
 
     /// All data is buffered, let go of mysql c api structures
     mysql_stmt_free_result(m_stmt);
+
+    m_currentRow.resize(m_fieldCount);
+    if (m_rowCount)
+        SetRowFields(m_currentRow.data(), 0);
+}
+
+void PreparedResultSet::SetRowFields(Field* fields, uint64 row)
+{
+    uint32 const* lengths = &m_fieldLengths[std::size_t(row) * m_fieldCount];
+    for (uint32 fIndex = 0; fIndex < m_fieldCount; ++fIndex)
+    {
+        fields[fIndex].SetMetadata(&m_fieldMetadata[fIndex]);
+
+        if (lengths[fIndex] == NullFieldLength)
+        {
+            fields[fIndex].SetByteValue(nullptr, 0);
+            continue;
+        }
+
+        char* buffer = (char*)m_rBind[fIndex].buffer + std::size_t(row) * m_rowSize;
+        switch (m_rBind[fIndex].buffer_type)
+        {
+            case MYSQL_TYPE_TINY_BLOB:
+            case MYSQL_TYPE_MEDIUM_BLOB:
+            case MYSQL_TYPE_LONG_BLOB:
+            case MYSQL_TYPE_BLOB:
+            case MYSQL_TYPE_STRING:
+            case MYSQL_TYPE_VAR_STRING:
+                // warning - the string will not be null-terminated if there is no space for it in the buffer
+                // when mysql_stmt_fetch returned MYSQL_DATA_TRUNCATED
+                // we cannot blindly null-terminate the data either as it may be retrieved as binary blob and not specifically a string
+                // in this case using Field::GetCString will result in garbage
+                /// @todo: remove Field::GetCString and use std::string_view in C++17
+                if (lengths[fIndex] < m_rBind[fIndex].buffer_length)
+                    buffer[lengths[fIndex]] = '\0';
+                break;
+            default:
+                break;
+        }
+
+        fields[fIndex].SetByteValue(buffer, lengths[fIndex]);
+    }
+}
+
+std::size_t PreparedResultSet::NextRowBatch(Field* rows, std::size_t maxRows)
+{
+    std::size_t rowCount = 0;
+    for (; rowCount < maxRows && m_rowPosition < m_rowCount; ++rowCount, ++m_rowPosition)
+        SetRowFields(rows + rowCount * m_fieldCount, m_rowPosition);
+
+    return rowCount;
 }
 
 PreparedResultSet::~PreparedResultSet()
@@ -384,11 +466,11 @@ PreparedResultSet::~PreparedResultSet()
 
 bool PreparedResultSet::NextRow()
 {
-    /// Only updates the m_rowPosition so upper level code knows in which element
-    /// of the rows vector to look
+    /// Only points the fields of the current row to the next buffered row
     if (++m_rowPosition >= m_rowCount)
         return false;
 
+    SetRowFields(m_currentRow.data(), m_rowPosition);
     return true;
 }
 
@@ -406,14 +488,14 @@ bool PreparedResultSet::_NextRow()
 Field* PreparedResultSet::Fetch() const
 {
     ASSERT(m_rowPosition < m_rowCount);
-    return const_cast<Field*>(&m_rows[uint32(m_rowPosition) * m_fieldCount]);
+    return const_cast<Field*>(m_currentRow.data());
 }
 
 Field const& PreparedResultSet::operator[](std::size_t index) const
 {
     ASSERT(m_rowPosition < m_rowCount);
     ASSERT(index < m_fieldCount);
-    return m_rows[uint32(m_rowPosition) * m_fieldCount + index];
+    return m_currentRow[index];
 }
 
 void PreparedResultSet::CleanUp()
@@ -21,6 +21,10 @@
 #include "DatabaseEnvFwd.h"
 #include "Define.h"
 #include "Field.h"
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <memory>
 #include <tuple>
 #include <vector>
 
@@ -45,11 +49,62 @@ private:
     pointer _ptr;
 };
 
+/// Block of rows decoded column by column with Field::GetColumn, used by FetchColumns and FetchRows
+template<typename... Ts>
+class ResultColumnBatch
+{
+public:
+    static constexpr std::size_t MaxRows = 256;
+
+    // rows holds rowCount rows of fieldCount contiguous fields
+    void Decode(Field const* rows, std::size_t fieldCount, std::size_t rowCount)
+    {
+        _rowCount = rowCount;
+        DecodeColumns(rows, fieldCount, std::index_sequence_for<Ts...>{});
+    }
+
+    void AppendTo(std::tuple<std::vector<Ts>...>& columns)
+    {
+        AppendColumns(columns, std::index_sequence_for<Ts...>{});
+    }
+
+    template<typename Row>
+    void AppendTo(std::vector<Row>& rows, std::tuple<Ts Row::*...> const& members)
+    {
+        for (std::size_t i = 0; i < _rowCount; ++i)
+            AssignRow(rows.emplace_back(), i, members, std::index_sequence_for<Ts...>{});
+    }
+
+private:
+    template<std::size_t... Is>
+    void DecodeColumns(Field const* rows, std::size_t fieldCount, std::index_sequence<Is...>)
+    {
+        (Field::GetColumn(rows + Is, fieldCount, _rowCount, std::get<Is>(_columns).data()), ...);
+    }
+
+    template<std::size_t... Is>
+    void AppendColumns(std::tuple<std::vector<Ts>...>& columns, std::index_sequence<Is...>)
+    {
+        (std::get<Is>(columns).insert(std::get<Is>(columns).end(),
+            std::make_move_iterator(std::get<Is>(_columns).begin()),
+            std::make_move_iterator(std::get<Is>(_columns).begin() + _rowCount)), ...);
+    }
+
+    template<typename Row, std::size_t... Is>
+    void AssignRow(Row& row, std::size_t index, std::tuple<Ts Row::*...> const& members, std::index_sequence<Is...>)
+    {
+        ((row.*std::get<Is>(members) = std::move(std::get<Is>(_columns)[index])), ...);
+    }
+
+    std::tuple<std::array<Ts, MaxRows>...> _columns;
+    std::size_t _rowCount = 0;
+};
+
 class AC_DATABASE_API ResultSet
 {
 public:
     ResultSet(MySQLResult* result, MySQLField* fields, uint64 rowCount, uint32 fieldCount);
-    ~ResultSet();
+    virtual ~ResultSet();
 
     bool NextRow();
     [[nodiscard]] uint64 GetRowCount() const { return _rowCount; }
@@ -75,10 +130,41 @@ public:
         return theTuple;
     }
 
+    /// Decodes the current row and all the rows after it into one vector per column, the result is consumed.
+    /// std::string_view columns point into the result and stay valid as long as the ResultSet.
+    template<typename... Ts>
+    std::tuple<std::vector<Ts>...> FetchColumns()
+    {
+        std::tuple<std::vector<Ts>...> columns;
+        DecodeRowBatches<Ts...>([&columns](ResultColumnBatch<Ts...>& batch) { batch.AppendTo(columns); });
+        return columns;
+    }
+
+    /// Decodes the current row and all the rows after it into Row structs, the result is consumed.
+    /// Column i is stored in the i-th member, which must have the type Get<T>() would be called with.
+    /// std::string_view members point into the result and stay valid as long as the ResultSet.
+    template<typename Row, typename... Ts>
+    std::vector<Row> FetchRows(Ts Row::*... members)
+    {
+        std::vector<Row> rows;
+        rows.reserve(_rowCount);
+
+        std::tuple<Ts Row::*...> const schema(members...);
+        DecodeRowBatches<Ts...>([&rows, &schema](ResultColumnBatch<Ts...>& batch) { batch.AppendTo(rows, schema); });
+        return rows;
+    }
+
     auto begin()      { return ResultIterator<ResultSet>(this); }
     static auto end() { return ResultIterator<ResultSet>(nullptr); }
 
 protected:
+    /// For rows that do not come from a mysql result, they are read through ReadRow
+    ResultSet(std::vector<QueryResultFieldMetadata> fieldMetadata, uint64 rowCount);
+
+    /// Values and lengths of the next row of the result, false after the last one. They stay valid until FreeResult().
+    virtual bool ReadRow(char**& values, unsigned long*& lengths);
+    virtual void FreeResult();
+
     std::vector<QueryResultFieldMetadata> _fieldMetadata;
     uint64 _rowCount;
     Field* _currentRow;
@@ -88,6 +174,24 @@ private:
     void CleanUp();
     void AssertRows(std::size_t sizeRows);
 
+    // copies up to maxRows rows, starting with the current one, and moves past them
+    // unlike NextRow the result is kept until the ResultSet is destroyed, so the copied fields stay valid
+    std::size_t NextRowBatch(Field* rows, std::size_t maxRows);
+
+    template<typename... Ts, typename Callback>
+    void DecodeRowBatches(Callback&& callback)
+    {
+        AssertRows(sizeof...(Ts));
+
+        auto batch = std::make_unique<ResultColumnBatch<Ts...>>();
+        std::vector<Field> rows(ResultColumnBatch<Ts...>::MaxRows * _fieldCount);
+        while (std::size_t rowCount = NextRowBatch(rows.data(), ResultColumnBatch<Ts...>::MaxRows))
+        {
+            batch->Decode(rows.data(), _fieldCount, rowCount);
+            callback(*batch);
+        }
+    }
+
     MySQLResult* _result;
     MySQLField* _fields;
 
@@ -118,23 +222,49 @@ public:
         std::apply([this](Ts&... args)
         {
             uint8 index{ 0 };
-            ((args = m_rows[uint32(m_rowPosition) * m_fieldCount + index].Get<Ts>(), index++), ...);
+            ((args = m_currentRow[index].Get<Ts>(), index++), ...);
         }, theTuple);
 
         return theTuple;
     }
 
+    /// Decodes the current row and all the rows after it into one vector per column, the result is consumed
+    template<typename... Ts>
+    std::tuple<std::vector<Ts>...> FetchColumns()
+    {
+        std::tuple<std::vector<Ts>...> columns;
+        DecodeRowBatches<Ts...>([&columns](ResultColumnBatch<Ts...>& batch) { batch.AppendTo(columns); });
+        return columns;
+    }
+
+    /// Decodes the current row and all the rows after it into Row structs, the result is consumed.
+    /// Column i is stored in the i-th member, which must have the type Get<T>() would be called with.
+    template<typename Row, typename... Ts>
+    std::vector<Row> FetchRows(Ts Row::*... members)
+    {
+        std::vector<Row> rows;
+        rows.reserve(m_rowCount - m_rowPosition);
+
+        std::tuple<Ts Row::*...> const schema(members...);
+        DecodeRowBatches<Ts...>([&rows, &schema](ResultColumnBatch<Ts...>& batch) { batch.AppendTo(rows, schema); });
+        return rows;
+    }
+
     auto begin()        { return ResultIterator<PreparedResultSet>(this); }
     static auto end()   { return ResultIterator<PreparedResultSet>(nullptr); }
 
 protected:
     std::vector<QueryResultFieldMetadata> m_fieldMetadata;
-    std::vector<Field> m_rows;
+    std::vector<Field> m_currentRow;
+    std::vector<uint32> m_fieldLengths;   ///< fetched length of every field of every row, NullFieldLength for NULL
+    std::size_t m_rowSize;                ///< every row has its own rowSize bytes block in the buffer bound to the statement
     uint64 m_rowCount;
     uint64 m_rowPosition;
     uint32 m_fieldCount;
 
 private:
+    static constexpr uint32 NullFieldLength = 0xFFFFFFFF;
+
     MySQLBind* m_rBind;
     MySQLStmt* m_stmt;
     MySQLResult* m_metadataResult;    ///< Field metadata, returned by mysql_stmt_result_metadata
@@ -144,6 +274,26 @@ private:
 
     void AssertRows(std::size_t sizeRows);
 
+    // points fields to the buffered values of the given row
+    void SetRowFields(Field* fields, uint64 row);
+
+    // same as ResultSet::NextRowBatch
+    std::size_t NextRowBatch(Field* rows, std::size_t maxRows);
+
+    template<typename... Ts, typename Callback>
+    void DecodeRowBatches(Callback&& callback)
+    {
+        AssertRows(sizeof...(Ts));
+
+        auto batch = std::make_unique<ResultColumnBatch<Ts...>>();
+        std::vector<Field> rows(ResultColumnBatch<Ts...>::MaxRows * m_fieldCount);
+        while (std::size_t rowCount = NextRowBatch(rows.data(), ResultColumnBatch<Ts...>::MaxRows))
+        {
+            batch->Decode(rows.data(), m_fieldCount, rowCount);
+            callback(*batch);
+        }
+    }
+
     PreparedResultSet(PreparedResultSet const& right) = delete;
     PreparedResultSet& operator=(PreparedResultSet const& right) = delete;
 };
@@ -40,6 +40,7 @@
 #include "MapMgr.h"
 #include "ObjectMgr.h"
 #include "Player.h"
+#include "PlayerLoginCache.h"
 #include "RBAC.h"
 #include "RaceMgr.h"
 #include "ReputationMgr.h"
@@ -3170,6 +3171,8 @@ void AchievementGlobalMgr::CompletedAchievementForOfflinePlayer(ObjectGuid::LowT
     stmt->SetData(3, 0);
     stmt->SetData(4, 0);
     CharacterDatabase.Execute(stmt);
+
+    sPlayerLoginCache->Invalidate(ObjectGuid::Create<HighGuid::Player>(playerLowGuid));
 }
 
 void AchievementGlobalMgr::UpdateAchievementCriteriaForOfflinePlayer(ObjectGuid::LowType playerLowGuid, AchievementCriteriaTypes type, uint32 miscValue1, uint32 miscValue2)
@@ -3181,4 +3184,6 @@ void AchievementGlobalMgr::UpdateAchievementCriteriaForOfflinePlayer(ObjectGuid:
     stmt->SetData(3, miscValue1);
     stmt->SetData(4, miscValue2);
     CharacterDatabase.Execute(stmt);
+
+    sPlayerLoginCache->Invalidate(ObjectGuid::Create<HighGuid::Player>(playerLowGuid));
 }
@@ -23,6 +23,7 @@
 #include "Log.h"
 #include "ObjectAccessor.h"
 #include "Player.h"
+#include "PlayerLoginCache.h"
 #include "ScriptMgr.h"
 #include "World.h"
 
@@ -252,6 +253,9 @@ void ArenaTeamMgr::DistributeArenaPoints()
 
     CharacterDatabase.CommitTransaction(trans);
 
+    // arena points of offline members and the weekly stats below change for every arena team member
+    sPlayerLoginCache->InvalidateAll();
+
     PlayerPoints.clear();
 
     ChatHandler(nullptr).SendWorldText(LANG_DIST_ARENA_POINTS_ONLINE_END);
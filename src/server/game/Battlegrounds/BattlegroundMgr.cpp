@@ -404,7 +404,12 @@ Battleground* BattlegroundMgr::CreateNewBattleground(BattlegroundTypeId original
     bool isRandom = bgTypeId != originalBgTypeId && !bg->isArena();
 
     bg->SetBracket(bracketEntry);
-    bg->SetInstanceID(sMapMgr->GenerateInstanceId());
+
+    // a pooled map is attached right away, the battleground takes over its instance id
+    MapInstanced* baseMap = sWorld->getIntConfig(CONFIG_BATTLEGROUND_MAP_POOL_SIZE) ? sMapMgr->CreateBaseMap(bg->GetMapId())->ToMapInstanced() : nullptr;
+    BattlegroundMap* pooledMap = baseMap ? baseMap->TakePooledBattlegroundMap(bg) : nullptr;
+
+    bg->SetInstanceID(pooledMap ? pooledMap->GetInstanceId() : sMapMgr->GenerateInstanceId());
     bg->SetClientInstanceID(CreateClientVisibleInstanceId(originalBgTypeId, bracketEntry->GetBracketId()));
     bg->Init();
     bg->SetStatus(STATUS_WAIT_JOIN); // start the joining of the bg
@@ -422,6 +427,9 @@ Battleground* BattlegroundMgr::CreateNewBattleground(BattlegroundTypeId original
         bg->SetMaxPlayersPerTeam(maxPlayersPerTeam);
     }
 
+    if (pooledMap)
+        baseMap->AddBattlegroundMap(pooledMap, bg);
+
     return bg;
 }
 
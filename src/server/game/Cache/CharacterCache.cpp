@@ -20,14 +20,188 @@
 #include "DatabaseEnv.h"
 #include "Log.h"
 #include "Player.h"
+#include "PlayerLoginCache.h"
 #include "Timer.h"
 #include "World.h"
-#include <unordered_map>
+#include <deque>
+#include <string_view>
+#include <vector>
 
 namespace
 {
-    std::unordered_map<ObjectGuid, CharacterCacheEntry> _characterCacheStore;
-    std::unordered_map<std::string, CharacterCacheEntry*> _characterCacheByNameStore;
+    /*
+     * Open addressing index over the entry storage: a slot only holds the key hash and the
+     * entry index, the key itself is read from the entry. Linear probing with backward shift
+     * deletion, so erasing leaves no tombstones behind.
+     */
+    class CharacterCacheIndex
+    {
+    public:
+        static constexpr uint32 InvalidEntry = 0xFFFFFFFF;
+
+        void Clear()
+        {
+            _slots.clear();
+            _size = 0;
+        }
+
+        void Reserve(std::size_t count)
+        {
+            // kept at most half full
+            std::size_t capacity = 16;
+            while (capacity < count * 2)
+                capacity *= 2;
+
+            if (capacity <= _slots.size())
+                return;
+
+            std::vector<Slot> oldSlots(capacity);
+            oldSlots.swap(_slots);
+
+            for (Slot const& slot : oldSlots)
+                if (slot.Entry != InvalidEntry)
+                    Place(slot);
+        }
+
+        template<class Matches>
+        [[nodiscard]] uint32 Find(uint32 hash, Matches const& matches) const
+        {
+            if (_slots.empty())
+                return InvalidEntry;
+
+            for (std::size_t i = Home(hash); _slots[i].Entry != InvalidEntry; i = Next(i))
+                if (_slots[i].Hash == hash && matches(_slots[i].Entry))
+                    return _slots[i].Entry;
+
+            return InvalidEntry;
+        }
+
+        // the key must not be in the index yet
+        void Insert(uint32 hash, uint32 entry)
+        {
+            Reserve(_size + 1);
+            Place({ hash, entry });
+            ++_size;
+        }
+
+        void Erase(uint32 hash, uint32 entry)
+        {
+            if (_slots.empty())
+                return;
+
+            std::size_t i = Home(hash);
+            for (; _slots[i].Entry != entry; i = Next(i))
+                if (_slots[i].Entry == InvalidEntry)
+                    return;
+
+            // move back every following slot that would no longer be reachable from its home slot
+            for (std::size_t j = Next(i); _slots[j].Entry != InvalidEntry; j = Next(j))
+            {
+                std::size_t home = Home(_slots[j].Hash);
+                if (((j - home) & Mask()) >= ((j - i) & Mask()))
+                {
+                    _slots[i] = _slots[j];
+                    i = j;
+                }
+            }
+
+            _slots[i] = Slot();
+            --_size;
+        }
+
+        [[nodiscard]] std::size_t Size() const { return _size; }
+
+    private:
+        struct Slot
+        {
+            uint32 Hash = 0;
+            uint32 Entry = InvalidEntry;
+        };
+
+        [[nodiscard]] std::size_t Mask() const { return _slots.size() - 1; }
+        [[nodiscard]] std::size_t Home(uint32 hash) const { return hash & Mask(); }
+        [[nodiscard]] std::size_t Next(std::size_t i) const { return (i + 1) & Mask(); }
+
+        void Place(Slot const& slot)
+        {
+            std::size_t i = Home(slot.Hash);
+            while (_slots[i].Entry != InvalidEntry)
+                i = Next(i);
+
+            _slots[i] = slot;
+        }
+
+        std::vector<Slot> _slots;
+        std::size_t _size = 0;
+    };
+
+    // entries never move, the pointers handed out stay valid until the entry is deleted
+    std::deque<CharacterCacheEntry> _characterCacheEntries;
+    std::vector<uint32> _freeCharacterCacheEntries;
+    CharacterCacheIndex _characterCacheByGuidIndex;
+    CharacterCacheIndex _characterCacheByNameIndex;
+
+    uint32 HashGuid(ObjectGuid const& guid)
+    {
+        // player guids are consecutive counters, spread them over the whole table
+        uint32 hash = guid.GetCounter();
+        hash ^= hash >> 16;
+        hash *= 0x85EBCA6B;
+        hash ^= hash >> 13;
+        hash *= 0xC2B2AE35;
+        hash ^= hash >> 16;
+        return hash;
+    }
+
+    uint32 HashName(std::string_view name)
+    {
+        return static_cast<uint32>(std::hash<std::string_view>()(name));
+    }
+
+    uint32 FindEntryByGuid(ObjectGuid const& guid)
+    {
+        return _characterCacheByGuidIndex.Find(HashGuid(guid), [&guid](uint32 entry)
+        {
+            return _characterCacheEntries[entry].Guid == guid;
+        });
+    }
+
+    uint32 FindEntryByName(std::string_view name)
+    {
+        return _characterCacheByNameIndex.Find(HashName(name), [name](uint32 entry)
+        {
+            return _characterCacheEntries[entry].Name == name;
+        });
+    }
+
+    CharacterCacheEntry* FindCharacterCacheEntry(ObjectGuid const& guid)
+    {
+        uint32 entry = FindEntryByGuid(guid);
+        return entry != CharacterCacheIndex::InvalidEntry ? &_characterCacheEntries[entry] : nullptr;
+    }
+
+    CharacterCacheEntry const* FindCharacterCacheEntryByName(std::string const& name)
+    {
+        uint32 entry = FindEntryByName(name);
+        return entry != CharacterCacheIndex::InvalidEntry ? &_characterCacheEntries[entry] : nullptr;
+    }
+
+    // a name points to a single character, the last one given that name
+    void SetCharacterCacheEntryName(uint32 entry, std::string const& name)
+    {
+        CharacterCacheEntry& data = _characterCacheEntries[entry];
+        if (FindEntryByName(data.Name) == entry)
+            _characterCacheByNameIndex.Erase(HashName(data.Name), entry);
+
+        data.Name = name;
+
+        uint32 hash = HashName(name);
+        uint32 previous = FindEntryByName(name);
+        if (previous != CharacterCacheIndex::InvalidEntry)
+            _characterCacheByNameIndex.Erase(hash, previous);
+
+        _characterCacheByNameIndex.Insert(hash, entry);
+    }
 }
 
 CharacterCache* CharacterCache::instance()
@@ -59,7 +233,10 @@ CharacterCache* CharacterCache::instance()
 
 void CharacterCache::LoadCharacterCacheStorage()
 {
-    _characterCacheStore.clear();
+    _characterCacheEntries.clear();
+    _freeCharacterCacheEntries.clear();
+    _characterCacheByGuidIndex.Clear();
+    _characterCacheByNameIndex.Clear();
     uint32 oldMSTime = getMSTime();
 
     QueryResult result = CharacterDatabase.Query("SELECT guid, name, account, race, gender, class, level FROM characters");
@@ -69,6 +246,10 @@ void CharacterCache::LoadCharacterCacheStorage()
         return;
     }
 
+    // sized once for the whole realm instead of growing while loading
+    _characterCacheByGuidIndex.Reserve(result->GetRowCount());
+    _characterCacheByNameIndex.Reserve(result->GetRowCount());
+
     do
     {
         Field* fields = result->Fetch();
@@ -86,7 +267,7 @@ void CharacterCache::LoadCharacterCacheStorage()
         } while (mailCountResult->NextRow());
     }
 
-    LOG_INFO("server.loading", ">> Loaded Character Infos For {} Characters in {} ms", _characterCacheStore.size(), GetMSTimeDiffToNow(oldMSTime));
+    LOG_INFO("server.loading", ">> Loaded Character Infos For {} Characters in {} ms", _characterCacheByGuidIndex.Size(), GetMSTimeDiffToNow(oldMSTime));
     LOG_INFO("server.loading", " ");
 }
 
@@ -121,9 +302,26 @@ Modifying functions
 */
 void CharacterCache::AddCharacterCacheEntry(ObjectGuid const& guid, uint32 accountId, std::string const& name, uint8 gender, uint8 race, uint8 playerClass, uint8 level)
 {
-    CharacterCacheEntry& data = _characterCacheStore[guid];
-    data.Guid = guid;
-    data.Name = name;
+    uint32 entry = FindEntryByGuid(guid);
+    if (entry == CharacterCacheIndex::InvalidEntry)
+    {
+        if (!_freeCharacterCacheEntries.empty())
+        {
+            entry = _freeCharacterCacheEntries.back();
+            _freeCharacterCacheEntries.pop_back();
+        }
+        else
+        {
+            entry = static_cast<uint32>(_characterCacheEntries.size());
+            _characterCacheEntries.emplace_back();
+        }
+
+        _characterCacheEntries[entry] = CharacterCacheEntry();
+        _characterCacheEntries[entry].Guid = guid;
+        _characterCacheByGuidIndex.Insert(HashGuid(guid), entry);
+    }
+
+    CharacterCacheEntry& data = _characterCacheEntries[entry];
     data.AccountId = accountId;
     data.Race = race;
     data.Sex = gender;
@@ -136,118 +334,138 @@ void CharacterCache::AddCharacterCacheEntry(ObjectGuid const& guid, uint32 accou
     }
 
     // Fill Name to Guid Store
-    _characterCacheByNameStore[name] = &data;
+    SetCharacterCacheEntryName(entry, name);
 }
 
 void CharacterCache::DeleteCharacterCacheEntry(ObjectGuid const& guid, std::string const& name)
 {
-    _characterCacheStore.erase(guid);
-    _characterCacheByNameStore.erase(name);
+    sPlayerLoginCache->Invalidate(guid);
+
+    uint32 entry = FindEntryByGuid(guid);
+    if (entry != CharacterCacheIndex::InvalidEntry)
+    {
+        CharacterCacheEntry& data = _characterCacheEntries[entry];
+        if (FindEntryByName(data.Name) == entry)
+            _characterCacheByNameIndex.Erase(HashName(data.Name), entry);
+
+        _characterCacheByGuidIndex.Erase(HashGuid(guid), entry);
+        data.Name.clear();
+        _freeCharacterCacheEntries.push_back(entry);
+    }
+
+    // the name may also be given to another character already
+    uint32 nameEntry = FindEntryByName(name);
+    if (nameEntry != CharacterCacheIndex::InvalidEntry)
+        _characterCacheByNameIndex.Erase(HashName(name), nameEntry);
 }
 
 void CharacterCache::UpdateCharacterData(ObjectGuid const& guid, std::string const& name, Optional<uint8> gender /*= {}*/, Optional<uint8> race /*= {}*/)
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
+    sPlayerLoginCache->Invalidate(guid);
+    uint32 entry = FindEntryByGuid(guid);
+    if (entry == CharacterCacheIndex::InvalidEntry)
         return;
 
-    std::string oldName = itr->second.Name;
-    itr->second.Name = name;
+    CharacterCacheEntry& data = _characterCacheEntries[entry];
 
     if (gender)
     {
-        itr->second.Sex = *gender;
+        data.Sex = *gender;
     }
 
     if (race)
     {
-        itr->second.Race = *race;
+        data.Race = *race;
     }
 
     //WorldPackets::Misc::InvalidatePlayer packet(guid);
     //sWorld->SendGlobalMessage(packet.Write());
 
-    // Correct name -> pointer storage
-    _characterCacheByNameStore.erase(oldName);
-    _characterCacheByNameStore[name] = &itr->second;
+    // Correct name -> entry index
+    SetCharacterCacheEntryName(entry, name);
 }
 
 void CharacterCache::UpdateCharacterLevel(ObjectGuid const& guid, uint8 level)
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
+    sPlayerLoginCache->Invalidate(guid);
+    CharacterCacheEntry* data = FindCharacterCacheEntry(guid);
+    if (!data)
     {
         return;
     }
 
-    itr->second.Level = level;
+    data->Level = level;
 }
 
 void CharacterCache::UpdateCharacterAccountId(ObjectGuid const& guid, uint32 accountId)
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
+    sPlayerLoginCache->Invalidate(guid);
+    CharacterCacheEntry* data = FindCharacterCacheEntry(guid);
+    if (!data)
     {
         return;
     }
 
-    itr->second.AccountId = accountId;
+    data->AccountId = accountId;
 }
 
 void CharacterCache::UpdateCharacterGuildId(ObjectGuid const& guid, ObjectGuid::LowType guildId)
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
+    sPlayerLoginCache->Invalidate(guid);
+    CharacterCacheEntry* data = FindCharacterCacheEntry(guid);
+    if (!data)
     {
         return;
     }
 
-    itr->second.GuildId = guildId;
+    data->GuildId = guildId;
 }
 
 void CharacterCache::UpdateCharacterArenaTeamId(ObjectGuid const& guid, uint8 slot, uint32 arenaTeamId)
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
+    sPlayerLoginCache->Invalidate(guid);
+    CharacterCacheEntry* data = FindCharacterCacheEntry(guid);
+    if (!data)
     {
         return;
     }
 
-    itr->second.ArenaTeamId[slot] = arenaTeamId;
+    data->ArenaTeamId[slot] = arenaTeamId;
 }
 
 void CharacterCache::UpdateCharacterMailCount(ObjectGuid const& guid, int8 count, bool update)
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
+    CharacterCacheEntry* data = FindCharacterCacheEntry(guid);
+    if (!data)
     {
         return;
     }
 
     if (update)
     {
-        itr->second.MailCount = count;
+        data->MailCount = count;
         return;
     }
 
     // Let's be safe and prevent overflow
-    if (!itr->second.MailCount && count < 0)
+    if (!data->MailCount && count < 0)
     {
         return;
     }
 
-    itr->second.MailCount += count;
+    data->MailCount += count;
 }
 
 void CharacterCache::UpdateCharacterGroup(ObjectGuid const& guid, ObjectGuid groupGUID)
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
+    sPlayerLoginCache->Invalidate(guid);
+    CharacterCacheEntry* data = FindCharacterCacheEntry(guid);
+    if (!data)
     {
         return;
     }
 
-    itr->second.GroupGuid = groupGUID;
+    data->GroupGuid = groupGUID;
 }
 
 /*
@@ -255,37 +473,24 @@ Getters
 */
 bool CharacterCache::HasCharacterCacheEntry(ObjectGuid const& guid) const
 {
-    return _characterCacheStore.find(guid) != _characterCacheStore.end();
+    return FindEntryByGuid(guid) != CharacterCacheIndex::InvalidEntry;
 }
 
 CharacterCacheEntry const* CharacterCache::GetCharacterCacheByGuid(ObjectGuid const& guid) const
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr != _characterCacheStore.end())
-    {
-        return &itr->second;
-    }
-
-    return nullptr;
+    return FindCharacterCacheEntry(guid);
 }
 
 CharacterCacheEntry const* CharacterCache::GetCharacterCacheByName(std::string const& name) const
 {
-    auto itr = _characterCacheByNameStore.find(name);
-    if (itr != _characterCacheByNameStore.end())
-    {
-        return itr->second;
-    }
-
-    return nullptr;
+    return FindCharacterCacheEntryByName(name);
 }
 
 ObjectGuid CharacterCache::GetCharacterGuidByName(std::string const& name) const
 {
-    auto itr = _characterCacheByNameStore.find(name);
-    if (itr != _characterCacheByNameStore.end())
+    if (CharacterCacheEntry const* data = FindCharacterCacheEntryByName(name))
     {
-        return itr->second->Guid;
+        return data->Guid;
     }
 
     return ObjectGuid::Empty;
@@ -293,44 +498,43 @@ ObjectGuid CharacterCache::GetCharacterGuidByName(std::string const& name) const
 
 bool CharacterCache::GetCharacterNameByGuid(ObjectGuid guid, std::string& name) const
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
+    CharacterCacheEntry const* data = FindCharacterCacheEntry(guid);
+    if (!data)
     {
         return false;
     }
 
-    name = itr->second.Name;
+    name = data->Name;
     return true;
 }
 
 uint32 CharacterCache::GetCharacterTeamByGuid(ObjectGuid guid) const
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
+    CharacterCacheEntry const* data = FindCharacterCacheEntry(guid);
+    if (!data)
     {
         return 0;
     }
 
-    return Player::TeamIdForRace(itr->second.Race);
+    return Player::TeamIdForRace(data->Race);
 }
 
 uint32 CharacterCache::GetCharacterAccountIdByGuid(ObjectGuid guid) const
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
+    CharacterCacheEntry const* data = FindCharacterCacheEntry(guid);
+    if (!data)
     {
         return 0;
     }
 
-    return itr->second.AccountId;
+    return data->AccountId;
 }
 
 uint32 CharacterCache::GetCharacterAccountIdByName(std::string const& name) const
 {
-    auto itr = _characterCacheByNameStore.find(name);
-    if (itr != _characterCacheByNameStore.end())
+    if (CharacterCacheEntry const* data = FindCharacterCacheEntryByName(name))
     {
-        return itr->second->AccountId;
+        return data->AccountId;
     }
 
     return 0;
@@ -338,44 +542,44 @@ uint32 CharacterCache::GetCharacterAccountIdByName(std::string const& name) cons
 
 uint8 CharacterCache::GetCharacterLevelByGuid(ObjectGuid guid) const
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
+    CharacterCacheEntry const* data = FindCharacterCacheEntry(guid);
+    if (!data)
     {
         return 0;
     }
 
-    return itr->second.Level;
+    return data->Level;
 }
 
 ObjectGuid::LowType CharacterCache::GetCharacterGuildIdByGuid(ObjectGuid guid) const
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
+    CharacterCacheEntry const* data = FindCharacterCacheEntry(guid);
+    if (!data)
     {
         return 0;
     }
 
-    return itr->second.GuildId;
+    return data->GuildId;
 }
 
 uint32 CharacterCache::GetCharacterArenaTeamIdByGuid(ObjectGuid guid, uint8 type) const
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
+    CharacterCacheEntry const* data = FindCharacterCacheEntry(guid);
+    if (!data)
     {
         return 0;
     }
 
-    return itr->second.ArenaTeamId[type];
+    return data->ArenaTeamId[type];
 }
 
 ObjectGuid CharacterCache::GetCharacterGroupGuidByGuid(ObjectGuid guid) const
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
+    CharacterCacheEntry const* data = FindCharacterCacheEntry(guid);
+    if (!data)
     {
         return ObjectGuid::Empty;
     }
 
-    return itr->second.GroupGuid;
+    return data->GroupGuid;
 }
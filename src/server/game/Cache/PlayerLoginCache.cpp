@@ -0,0 +1,198 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "PlayerLoginCache.h"
+#include "DatabaseEnv.h"
+#include "GameTime.h"
+#include "Log.h"
+#include "World.h"
+
+PlayerLoginCache* PlayerLoginCache::instance()
+{
+    static PlayerLoginCache instance;
+    return &instance;
+}
+
+bool PlayerLoginCache::IsEnabled() const
+{
+    return sWorld->getBoolConfig(CONFIG_PLAYER_LOGIN_CACHE_ENABLED);
+}
+
+bool PlayerLoginCache::RecordLogout(ObjectGuid guid)
+{
+    std::lock_guard<std::mutex> guard(_lock);
+    _logoutTimes[guid] = GameTime::GetGameTime();
+    return _quickReloggers.find(guid) != _quickReloggers.end();
+}
+
+void PlayerLoginCache::AddLogoutSave(ObjectGuid guid, uint32 accountId, TransactionCallback&& saveCallback, LoginQueryLoader loader)
+{
+    uint32 generation;
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+        generation = ++_generation;
+
+        Entry& entry = _entries[guid];
+        entry.Query.reset();
+        entry.Loaded = false;
+        entry.AccountId = accountId;
+        entry.Generation = generation;
+    }
+
+    _saveCallbacks.AddCallback(std::move(saveCallback)).AfterComplete([this, guid, generation, loader = std::move(loader)](bool success)
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+        auto itr = _entries.find(guid);
+        // invalidated or logged in again while saving
+        if (itr == _entries.end() || itr->second.Generation != generation)
+            return;
+
+        if (success)
+        {
+            SQLQueryHolderCallback query = loader();
+            if (query.m_holder)
+            {
+                itr->second.Query.emplace(std::move(query));
+                return;
+            }
+        }
+
+        _entries.erase(itr);
+    });
+}
+
+std::optional<SQLQueryHolderCallback> PlayerLoginCache::Take(ObjectGuid guid, uint32 accountId)
+{
+    std::lock_guard<std::mutex> guard(_lock);
+
+    Seconds const now = GameTime::GetGameTime();
+    Seconds const duration = Seconds(sWorld->getIntConfig(CONFIG_PLAYER_LOGIN_CACHE_DURATION));
+
+    // warm the character up on its next logout only if it came back quickly this time
+    auto logout = _logoutTimes.find(guid);
+    if (logout != _logoutTimes.end() && logout->second + duration > now)
+    {
+        if (_quickReloggers.size() < sWorld->getIntConfig(CONFIG_PLAYER_LOGIN_CACHE_MAX_ENTRIES))
+            _quickReloggers.insert(guid);
+    }
+    else
+        _quickReloggers.erase(guid);
+
+    if (logout != _logoutTimes.end())
+        _logoutTimes.erase(logout);
+
+    std::optional<SQLQueryHolderCallback> query;
+
+    auto itr = _entries.find(guid);
+    if (itr != _entries.end())
+    {
+        // a login always consumes the entry, a pending save leaves the character to be loaded from the database
+        Entry& entry = itr->second;
+        if (entry.Query && entry.AccountId == accountId && (!entry.Loaded || entry.ExpireTime > now))
+        {
+            LOG_DEBUG("entities.player.loading", "PlayerLoginCache: using {} login queries for {}", entry.Loaded ? "cached" : "loading", guid.ToString());
+            query = std::move(entry.Query);
+        }
+
+        _entries.erase(itr);
+    }
+
+    // the instance lock times are loaded per account, any login may change them for the other characters
+    for (auto other = _entries.begin(); other != _entries.end();)
+    {
+        if (other->second.AccountId == accountId)
+            other = _entries.erase(other);
+        else
+            ++other;
+    }
+
+    return query;
+}
+
+void PlayerLoginCache::Invalidate(ObjectGuid guid)
+{
+    std::lock_guard<std::mutex> guard(_lock);
+    _entries.erase(guid);
+}
+
+void PlayerLoginCache::InvalidateAll()
+{
+    std::lock_guard<std::mutex> guard(_lock);
+    _entries.clear();
+}
+
+void PlayerLoginCache::Update()
+{
+    _saveCallbacks.ProcessReadyCallbacks();
+
+    std::lock_guard<std::mutex> guard(_lock);
+
+    Seconds const now = GameTime::GetGameTime();
+    Seconds const duration = Seconds(sWorld->getIntConfig(CONFIG_PLAYER_LOGIN_CACHE_DURATION));
+
+    bool loaded = false;
+    for (auto itr = _entries.begin(); itr != _entries.end();)
+    {
+        Entry& entry = itr->second;
+        if (!entry.Loaded)
+        {
+            if (entry.Query && entry.Query->m_future.wait_for(0s) == std::future_status::ready)
+            {
+                entry.Loaded = true;
+                entry.ExpireTime = now + duration;
+                loaded = true;
+            }
+        }
+        else if (entry.ExpireTime <= now)
+        {
+            // nobody came back for it, stop warming this character up
+            _quickReloggers.erase(itr->first);
+            itr = _entries.erase(itr);
+            continue;
+        }
+
+        ++itr;
+    }
+
+    // keep the cache bounded, drop the entries closest to expiring
+    uint32 const maxEntries = sWorld->getIntConfig(CONFIG_PLAYER_LOGIN_CACHE_MAX_ENTRIES);
+    while (loaded && _entries.size() > maxEntries)
+    {
+        auto oldest = _entries.end();
+        for (auto entry = _entries.begin(); entry != _entries.end(); ++entry)
+            if (entry->second.Loaded && (oldest == _entries.end() || entry->second.ExpireTime < oldest->second.ExpireTime))
+                oldest = entry;
+
+        if (oldest == _entries.end())
+            break;
+
+        _entries.erase(oldest);
+    }
+
+    if (now >= _nextLogoutPrune)
+    {
+        for (auto itr = _logoutTimes.begin(); itr != _logoutTimes.end();)
+        {
+            if (itr->second + duration <= now)
+                itr = _logoutTimes.erase(itr);
+            else
+                ++itr;
+        }
+
+        _nextLogoutPrune = now + duration;
+    }
+}
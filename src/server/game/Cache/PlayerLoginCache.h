@@ -0,0 +1,97 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _PLAYER_LOGIN_CACHE_H_
+#define _PLAYER_LOGIN_CACHE_H_
+
+#include "AsyncCallbackProcessor.h"
+#include "DatabaseEnvFwd.h"
+#include "Duration.h"
+#include "ObjectGuid.h"
+#include "QueryHolder.h"
+#include "Transaction.h"
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <unordered_set>
+
+/**
+ * @brief Keeps the login queries of recently logged out characters in memory.
+ *
+ * Only characters that came back within PlayerLoginCache.Duration seconds of their
+ * previous logout are warmed up: their login query holder is loaded again once the
+ * logout save has been committed, so the results match the last save. A relog that
+ * finds the holder still loading takes over the pending load instead of issuing it twice.
+ * A warmed entry that expires unused stops the warm-up for that character until it
+ * relogs quickly again.
+ *
+ * Any code changing the stored data of an offline character must call Invalidate(),
+ * updates applied to all characters at once (quest resets, arena points) call InvalidateAll().
+ * Login queries scoped to the account (instance lock times) make every login drop the
+ * entries of the other characters of the account.
+ */
+class AC_GAME_API PlayerLoginCache
+{
+    PlayerLoginCache() = default;
+    ~PlayerLoginCache() = default;
+
+public:
+    /// Issues the login queries of a character, a callback without holder if they could not be prepared
+    using LoginQueryLoader = std::function<SQLQueryHolderCallback()>;
+
+    static PlayerLoginCache* instance();
+
+    [[nodiscard]] bool IsEnabled() const;
+
+    /// Records the logout of the character, returns true if its login queries should be warmed up after the save
+    bool RecordLogout(ObjectGuid guid);
+
+    /// Loads the login queries of the character once its logout save transaction has been committed
+    void AddLogoutSave(ObjectGuid guid, uint32 accountId, TransactionCallback&& saveCallback, LoginQueryLoader loader);
+
+    /// Removes and returns the cached or still loading login queries of the character
+    std::optional<SQLQueryHolderCallback> Take(ObjectGuid guid, uint32 accountId);
+
+    void Invalidate(ObjectGuid guid);
+    void InvalidateAll();
+
+    void Update();
+
+private:
+    struct Entry
+    {
+        std::optional<SQLQueryHolderCallback> Query; // empty until the logout save is committed
+        bool Loaded = false;
+        uint32 AccountId = 0;
+        uint32 Generation = 0;
+        Seconds ExpireTime = 0s;
+    };
+
+    std::mutex _lock;
+    std::unordered_map<ObjectGuid, Entry> _entries;
+    std::unordered_map<ObjectGuid, Seconds> _logoutTimes;
+    std::unordered_set<ObjectGuid> _quickReloggers;
+    uint32 _generation = 0;
+    Seconds _nextLogoutPrune = 0s;
+
+    AsyncCallbackProcessor<TransactionCallback> _saveCallbacks;
+};
+
+#define sPlayerLoginCache PlayerLoginCache::instance()
+
+#endif
@@ -19,8 +19,8 @@
 #include "AreaDefines.h"
 #include "GuildMgr.h"
 #include "ObjectAccessor.h"
-#include "World.h"
-#include "WorldSessionMgr.h"
+#include "Player.h"
+#include "WorldSession.h"
 
 WhoListCacheMgr* WhoListCacheMgr::instance()
 {
@@ -28,15 +28,26 @@ WhoListCacheMgr* WhoListCacheMgr::instance()
     return &instance;
 }
 
+void WhoListCacheMgr::MarkDirty(ObjectGuid guid)
+{
+    std::lock_guard<std::mutex> guard(_dirtyLock);
+    _dirtyPlayers.insert(guid);
+}
+
 void WhoListCacheMgr::Update()
 {
-    // clear current list
-    _whoListStorage.clear();
-    _whoListStorage.reserve(sWorldSessionMgr->GetPlayerCount() + 1);
+    std::unordered_set<ObjectGuid> dirtyPlayers;
+    {
+        std::lock_guard<std::mutex> guard(_dirtyLock);
+        dirtyPlayers.swap(_dirtyPlayers);
+    }
 
-    for (auto const& [guid, player] : ObjectAccessor::GetPlayers())
+    for (ObjectGuid const& guid : dirtyPlayers)
     {
-        if (!player->FindMap() || player->GetSession()->PlayerLoading())
+        _index.Remove(guid);
+
+        Player* player = ObjectAccessor::FindConnectedPlayer(guid);
+        if (!player || !player->FindMap() || player->GetSession()->PlayerLoading())
             continue;
 
         std::string playerName = player->GetName();
@@ -55,9 +66,51 @@ void WhoListCacheMgr::Update()
 
         wstrToLower(wideGuildName);
 
-        _whoListStorage.emplace_back(player->GetGUID(), player->GetTeamId(), player->GetSession()->GetSecurity(), player->GetLevel(),
+        _index.Add(WhoListPlayerInfo(player->GetGUID(), player->GetTeamId(), player->GetSession()->GetSecurity(), player->GetLevel(),
             player->getClass(), player->getRace(),
             (player->IsSpectator() ? AREA_DALARAN : player->GetZoneId()), player->getGender(), player->IsVisible(),
-            widePlayerName, wideGuildName, playerName, guildName);
+            widePlayerName, wideGuildName, playerName, guildName));
     }
 }
+
+void WhoListIndex::Add(WhoListPlayerInfo&& info)
+{
+    ObjectGuid guid = info.GetGuid();
+    Remove(guid);
+
+    WhoListEntry& entry = _entries.emplace(guid, WhoListEntry{ std::move(info), 0, 0 }).first->second;
+
+    std::vector<WhoListEntry*>& levelBucket = _levelBuckets[entry.Info.GetLevel()];
+    entry.LevelSlot = levelBucket.size();
+    levelBucket.push_back(&entry);
+
+    std::vector<WhoListEntry*>& zoneBucket = _zoneBuckets[entry.Info.GetZoneId()];
+    entry.ZoneSlot = zoneBucket.size();
+    zoneBucket.push_back(&entry);
+}
+
+void WhoListIndex::Remove(ObjectGuid guid)
+{
+    auto itr = _entries.find(guid);
+    if (itr == _entries.end())
+        return;
+
+    WhoListEntry& entry = itr->second;
+
+    // swap with the last entry of the bucket, keeping the slot of the moved entry up to date
+    std::vector<WhoListEntry*>& levelBucket = _levelBuckets[entry.Info.GetLevel()];
+    levelBucket[entry.LevelSlot] = levelBucket.back();
+    levelBucket[entry.LevelSlot]->LevelSlot = entry.LevelSlot;
+    levelBucket.pop_back();
+
+    auto zoneItr = _zoneBuckets.find(entry.Info.GetZoneId());
+    std::vector<WhoListEntry*>& zoneBucket = zoneItr->second;
+    zoneBucket[entry.ZoneSlot] = zoneBucket.back();
+    zoneBucket[entry.ZoneSlot]->ZoneSlot = entry.ZoneSlot;
+    zoneBucket.pop_back();
+
+    if (zoneBucket.empty())
+        _zoneBuckets.erase(zoneItr);
+
+    _entries.erase(itr);
+}
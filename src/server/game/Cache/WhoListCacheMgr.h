@@ -19,8 +19,13 @@
 #define _WHO_LISTCACHE_H_
 
 #include "Common.h"
+#include "DBCEnums.h"
 #include "ObjectGuid.h"
 #include "SharedDefines.h"
+#include <algorithm>
+#include <array>
+#include <mutex>
+#include <unordered_set>
 
 class WhoListPlayerInfo
 {
@@ -71,7 +76,63 @@ private:
     std::string _guildName;
 };
 
-using WhoListInfoVector = std::vector<WhoListPlayerInfo>;
+/// Listed players bucketed by level and by zone, so a who request only walks the players it can match
+class AC_GAME_API WhoListIndex
+{
+public:
+    WhoListIndex() = default;
+
+    WhoListIndex(WhoListIndex const&) = delete;
+    WhoListIndex& operator= (WhoListIndex const&) = delete;
+
+    // Lists the player, replacing its previous entry if any
+    void Add(WhoListPlayerInfo&& info);
+    void Remove(ObjectGuid guid);
+
+    std::size_t GetSize() const { return _entries.size(); }
+
+    // Calls visitor for every listed player in the level range, only for those in one of the zones if any are given
+    template<typename Visitor>
+    void VisitPlayers(uint32 levelMin, uint32 levelMax, std::vector<uint32> zones, Visitor&& visitor) const
+    {
+        levelMax = std::min<uint32>(levelMax, STRONG_MAX_LEVEL);
+
+        if (!zones.empty())
+        {
+            std::sort(zones.begin(), zones.end());
+            zones.erase(std::unique(zones.begin(), zones.end()), zones.end());
+
+            for (uint32 zoneId : zones)
+            {
+                auto itr = _zoneBuckets.find(zoneId);
+                if (itr == _zoneBuckets.end())
+                    continue;
+
+                for (WhoListEntry const* entry : itr->second)
+                    if (entry->Info.GetLevel() >= levelMin && entry->Info.GetLevel() <= levelMax)
+                        visitor(entry->Info);
+            }
+
+            return;
+        }
+
+        for (uint32 level = levelMin; level <= levelMax; ++level)
+            for (WhoListEntry const* entry : _levelBuckets[level])
+                visitor(entry->Info);
+    }
+
+private:
+    struct WhoListEntry
+    {
+        WhoListPlayerInfo Info;
+        std::size_t LevelSlot;
+        std::size_t ZoneSlot;
+    };
+
+    std::unordered_map<ObjectGuid, WhoListEntry> _entries;
+    std::array<std::vector<WhoListEntry*>, STRONG_MAX_LEVEL + 1> _levelBuckets;
+    std::unordered_map<uint32, std::vector<WhoListEntry*>> _zoneBuckets;
+};
 
 class AC_GAME_API WhoListCacheMgr
 {
@@ -86,11 +147,24 @@ class AC_GAME_API WhoListCacheMgr
 public:
     static WhoListCacheMgr* instance();
 
+    // Queues the player's entry for a refresh, safe to call from map threads.
+    // Called on login, logout, map changes and level, zone, guild, visibility and security changes.
+    void MarkDirty(ObjectGuid guid);
+
+    // Refreshes the queued entries, world thread only
     void Update();
-    WhoListInfoVector const& GetWhoList() const { return _whoListStorage; }
 
-protected:
-    WhoListInfoVector _whoListStorage;
+    template<typename Visitor>
+    void VisitPlayers(uint32 levelMin, uint32 levelMax, std::vector<uint32> zones, Visitor&& visitor) const
+    {
+        _index.VisitPlayers(levelMin, levelMax, std::move(zones), std::forward<Visitor>(visitor));
+    }
+
+private:
+    WhoListIndex _index;
+
+    std::mutex _dirtyLock;
+    std::unordered_set<ObjectGuid> _dirtyPlayers;
 };
 
 #define sWhoListCacheMgr WhoListCacheMgr::instance()
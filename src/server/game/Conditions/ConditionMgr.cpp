@@ -868,69 +868,74 @@ ConditionMgr* ConditionMgr::instance()
     return &instance;
 }
 
-ConditionList ConditionMgr::GetConditionReferences(uint32 refId)
+namespace
+{
+    ConditionList const EmptyConditionList;
+}
+
+ConditionList const& ConditionMgr::GetConditionReferences(uint32 refId) const
 {
-    ConditionList                               conditions;
     ConditionReferenceContainer::const_iterator ref = ConditionReferenceStore.find(refId);
     if (ref != ConditionReferenceStore.end())
-        conditions = (*ref).second;
-    return conditions;
+        return (*ref).second;
+    return EmptyConditionList;
 }
 
 uint32 ConditionMgr::GetSearcherTypeMaskForConditionList(ConditionList const& conditions)
 {
     if (conditions.empty())
         return GRID_MAP_TYPE_MASK_ALL;
-    //     groupId, typeMask
-    std::map<uint32, uint32> ElseGroupStore;
-    for (ConditionList::const_iterator i = conditions.begin(); i != conditions.end(); ++i)
-    {
-        // no point of having not loaded conditions in list
-        ASSERT((*i)->isLoaded() && "ConditionMgr::GetSearcherTypeMaskForConditionList - not yet loaded condition found in list");
-        std::map<uint32, uint32>::const_iterator itr = ElseGroupStore.find((*i)->ElseGroup);
-        // group not filled yet, fill with widest mask possible
-        if (itr == ElseGroupStore.end())
-            ElseGroupStore[(*i)->ElseGroup] = GRID_MAP_TYPE_MASK_ALL;
-        // no point of checking anymore, empty mask
-        else if (!(*itr).second)
-            continue;
 
-        if ((*i)->ReferenceId) // handle reference
-        {
-            ConditionReferenceContainer::const_iterator ref = ConditionReferenceStore.find((*i)->ReferenceId);
-            ASSERT(ref != ConditionReferenceStore.end() && "ConditionMgr::GetSearcherTypeMaskForConditionList - incorrect reference");
-            ElseGroupStore[(*i)->ElseGroup] &= GetSearcherTypeMaskForConditionList((*ref).second);
-        }
-        else // handle normal condition
-        {
-            // object will match conditions in one ElseGroupStore only when it matches all of them
-            // so, let's find a smallest possible mask which satisfies all conditions
-            ElseGroupStore[(*i)->ElseGroup] &= (*i)->GetSearcherTypeMaskForCondition();
-        }
-    }
-    // object will match condition when one of the checks in ElseGroupStore is matching
+    // object will match condition when one of the else groups is matching
     // so, let's include all possible masks
     uint32 mask = 0;
-    for (std::map<uint32, uint32>::const_iterator i = ElseGroupStore.begin(); i != ElseGroupStore.end(); ++i) mask |= i->second;
+    for (ConditionList::const_iterator i = conditions.begin(); i != conditions.end();)
+    {
+        // object will match conditions in one else group only when it matches all of them
+        // so, let's find a smallest possible mask which satisfies all conditions
+        uint32 const elseGroup = (*i)->ElseGroup;
+        uint32 groupMask = GRID_MAP_TYPE_MASK_ALL;
+        for (; i != conditions.end() && (*i)->ElseGroup == elseGroup; ++i)
+        {
+            // no point of having not loaded conditions in list
+            ASSERT((*i)->isLoaded() && "ConditionMgr::GetSearcherTypeMaskForConditionList - not yet loaded condition found in list");
+            // no point of checking anymore, empty mask
+            if (!groupMask)
+                continue;
+
+            if ((*i)->ReferenceId) // handle reference
+            {
+                ConditionReferenceContainer::const_iterator ref = ConditionReferenceStore.find((*i)->ReferenceId);
+                ASSERT(ref != ConditionReferenceStore.end() && "ConditionMgr::GetSearcherTypeMaskForConditionList - incorrect reference");
+                groupMask &= GetSearcherTypeMaskForConditionList((*ref).second);
+            }
+            else // handle normal condition
+                groupMask &= (*i)->GetSearcherTypeMaskForCondition();
+        }
+
+        mask |= groupMask;
+    }
 
     return mask;
 }
 
 bool ConditionMgr::IsObjectMeetToConditionList(ConditionSourceInfo& sourceInfo, ConditionList const& conditions)
 {
-    //     groupId, groupCheckPassed
-    std::map<uint32, bool> ElseGroupStore;
-    for (ConditionList::const_iterator i = conditions.begin(); i != conditions.end(); ++i)
-    {
-        LOG_DEBUG("condition", "ConditionMgr::IsPlayerMeetToConditionList condType: {} val1: {}", (*i)->ConditionType, (*i)->ConditionValue1);
-        if ((*i)->isLoaded())
-        {
-            //! Find ElseGroup in ElseGroupStore
-            std::map<uint32, bool>::const_iterator itr = ElseGroupStore.find((*i)->ElseGroup);
-            //! If not found, add an entry in the store and set to true (placeholder)
-            if (itr == ElseGroupStore.end())
-                ElseGroupStore[(*i)->ElseGroup] = true;
-            else if (!(*itr).second)
+    // conditions of the same else group are contiguous, so each group is checked in a single pass
+    // and the first group having all of its conditions met decides the result
+    for (ConditionList::const_iterator i = conditions.begin(); i != conditions.end();)
+    {
+        uint32 const elseGroup = (*i)->ElseGroup;
+        bool groupLoaded = false;
+        bool groupMeets = true;
+        for (; i != conditions.end() && (*i)->ElseGroup == elseGroup; ++i)
+        {
+            LOG_DEBUG("condition", "ConditionMgr::IsPlayerMeetToConditionList condType: {} val1: {}", (*i)->ConditionType, (*i)->ConditionValue1);
+            if (!(*i)->isLoaded())
+                continue;
+
+            groupLoaded = true;
+            if (!groupMeets)
                 continue;
 
             if ((*i)->ReferenceId) // handle reference
@@ -939,7 +944,7 @@ bool ConditionMgr::IsObjectMeetToConditionList(ConditionSourceInfo& sourceInfo,
                 if (ref != ConditionReferenceStore.end())
                 {
                     if (!IsObjectMeetToConditionList(sourceInfo, (*ref).second))
-                        ElseGroupStore[(*i)->ElseGroup] = false;
+                        groupMeets = false;
                 }
                 else
                 {
@@ -949,13 +954,13 @@ bool ConditionMgr::IsObjectMeetToConditionList(ConditionSourceInfo& sourceInfo,
             else // handle normal condition
             {
                 if (!(*i)->Meets(sourceInfo))
-                    ElseGroupStore[(*i)->ElseGroup] = false;
+                    groupMeets = false;
             }
         }
-    }
-    for (std::map<uint32, bool>::const_iterator i = ElseGroupStore.begin(); i != ElseGroupStore.end(); ++i)
-        if (i->second)
+
+        if (groupLoaded && groupMeets)
             return true;
+    }
 
     return false;
 }
@@ -993,9 +998,8 @@ bool ConditionMgr::CanHaveSourceIdSet(ConditionSourceType sourceType) const
     return (sourceType == CONDITION_SOURCE_TYPE_SMART_EVENT || sourceType == CONDITION_SOURCE_TYPE_OBJECT_VISIBILITY);
 }
 
-ConditionList ConditionMgr::GetConditionsForNotGroupedEntry(ConditionSourceType sourceType, uint32 entry)
+ConditionList const& ConditionMgr::GetConditionsForNotGroupedEntry(ConditionSourceType sourceType, uint32 entry) const
 {
-    ConditionList spellCond;
     if (sourceType > CONDITION_SOURCE_TYPE_NONE && sourceType < CONDITION_SOURCE_TYPE_MAX)
     {
         ConditionContainer::const_iterator itr = ConditionStore.find(sourceType);
@@ -1004,72 +1008,67 @@ ConditionList ConditionMgr::GetConditionsForNotGroupedEntry(ConditionSourceType
             ConditionTypeContainer::const_iterator i = (*itr).second.find(entry);
             if (i != (*itr).second.end())
             {
-                spellCond = (*i).second;
                 LOG_DEBUG("condition", "GetConditionsForNotGroupedEntry: found conditions for type {} and entry {}", uint32(sourceType), entry);
+                return (*i).second;
             }
         }
     }
-    return spellCond;
+    return EmptyConditionList;
 }
 
-ConditionList ConditionMgr::GetConditionsForSpellClickEvent(uint32 creatureId, uint32 spellId)
+ConditionList const& ConditionMgr::GetConditionsForSpellClickEvent(uint32 creatureId, uint32 spellId) const
 {
-    ConditionList                                   cond;
     CreatureSpellConditionContainer::const_iterator itr = SpellClickEventConditionStore.find(creatureId);
     if (itr != SpellClickEventConditionStore.end())
     {
         ConditionTypeContainer::const_iterator i = (*itr).second.find(spellId);
         if (i != (*itr).second.end())
         {
-            cond = (*i).second;
             LOG_DEBUG("condition", "GetConditionsForSpellClickEvent: found conditions for Vehicle entry {} spell {}", creatureId, spellId);
+            return (*i).second;
         }
     }
-    return cond;
+    return EmptyConditionList;
 }
 
-ConditionList ConditionMgr::GetConditionsForVehicleSpell(uint32 creatureId, uint32 spellId)
+ConditionList const& ConditionMgr::GetConditionsForVehicleSpell(uint32 creatureId, uint32 spellId) const
 {
-    ConditionList                                   cond;
     CreatureSpellConditionContainer::const_iterator itr = VehicleSpellConditionStore.find(creatureId);
     if (itr != VehicleSpellConditionStore.end())
     {
         ConditionTypeContainer::const_iterator i = (*itr).second.find(spellId);
         if (i != (*itr).second.end())
         {
-            cond = (*i).second;
             LOG_DEBUG("condition", "GetConditionsForVehicleSpell: found conditions for Vehicle entry {} spell {}", creatureId, spellId);
+            return (*i).second;
         }
     }
-    return cond;
+    return EmptyConditionList;
 }
 
-ConditionList ConditionMgr::GetConditionsForSmartEvent(int32 entryOrGuid, uint32 eventId, uint32 sourceType)
+ConditionList const& ConditionMgr::GetConditionsForSmartEvent(int32 entryOrGuid, uint32 eventId, uint32 sourceType) const
 {
-    ConditionList                                cond;
     SmartEventConditionContainer::const_iterator itr = SmartEventConditionStore.find(std::make_pair(entryOrGuid, sourceType));
     if (itr != SmartEventConditionStore.end())
     {
         ConditionTypeContainer::const_iterator i = (*itr).second.find(eventId + 1);
         if (i != (*itr).second.end())
         {
-            cond = (*i).second;
             LOG_DEBUG("condition", "GetConditionsForSmartEvent: found conditions for Smart Event entry or guid {} event_id {}", entryOrGuid, eventId);
+            return (*i).second;
         }
     }
-    return cond;
+    return EmptyConditionList;
 }
 
-ConditionList ConditionMgr::GetConditionsForNpcVendorEvent(uint32 creatureId, uint32 itemId)
+ConditionList const& ConditionMgr::GetConditionsForNpcVendorEvent(uint32 creatureId, uint32 itemId) const
 {
-    ConditionList                               cond;
     NpcVendorConditionContainer::const_iterator itr = NpcVendorConditionContainerStore.find(creatureId);
     if (itr != NpcVendorConditionContainerStore.end())
     {
         ConditionTypeContainer::const_iterator i = (*itr).second.find(itemId);
         if (i != (*itr).second.end())
         {
-            cond = (*i).second;
             if (itemId)
             {
                 LOG_DEBUG("condition", "GetConditionsForNpcVendorEvent: found conditions for creature entry {} item {}", creatureId, itemId);
@@ -1078,24 +1077,23 @@ ConditionList ConditionMgr::GetConditionsForNpcVendorEvent(uint32 creatureId, ui
             {
                 LOG_DEBUG("condition", "GetConditionsForNpcVendorEvent: found conditions for creature entry {}", creatureId);
             }
+            return (*i).second;
         }
     }
-    return cond;
+    return EmptyConditionList;
 }
 
-ConditionList ConditionMgr::GetConditionsForObjectVisibility(const WorldObject* object) const
+ConditionList const& ConditionMgr::GetConditionsForObjectVisibility(const WorldObject* object) const
 {
-    ConditionList cond;
-
     if (!object->IsCreature() && !object->IsGameObject())
-        return cond;
+        return EmptyConditionList;
 
     uint32 entry = object->GetEntry();
     uint32 sourceGroup = object->IsGameObject() ? 1 : 0;
 
     auto itrBucket = ObjectVisibilityConditionStore.find(std::make_pair(entry, sourceGroup));
     if (itrBucket == ObjectVisibilityConditionStore.end())
-        return cond;
+        return EmptyConditionList;
 
     uint32 guid = object->IsGameObject() ? object->ToGameObject()->GetSpawnId() : object->ToCreature()->GetSpawnId();
 
@@ -1104,20 +1102,18 @@ ConditionList ConditionMgr::GetConditionsForObjectVisibility(const WorldObject*
     auto itrGuid = sourceIdConditions.find(guid);
     if (itrGuid != sourceIdConditions.end())
     {
-        cond.insert(cond.end(), itrGuid->second.begin(), itrGuid->second.end());
         LOG_DEBUG("condition", "GetConditionsForObjectVisibility: found guid-level conditions for sourceGroup {} entry {} guid {}", sourceGroup, entry, guid);
+        return itrGuid->second;
     }
-    else
+
+    auto itrEntry = sourceIdConditions.find(0);
+    if (itrEntry != sourceIdConditions.end())
     {
-        auto itrEntry = sourceIdConditions.find(0);
-        if (itrEntry != sourceIdConditions.end())
-        {
-            cond.insert(cond.end(), itrEntry->second.begin(), itrEntry->second.end());
-            LOG_DEBUG("condition", "GetConditionsForObjectVisibility: found entry-level conditions for sourceGroup {} entry {}", sourceGroup, entry);
-        }
+        LOG_DEBUG("condition", "GetConditionsForObjectVisibility: found entry-level conditions for sourceGroup {} entry {}", sourceGroup, entry);
+        return itrEntry->second;
     }
 
-    return cond;
+    return EmptyConditionList;
 }
 
 void ConditionMgr::LoadConditions(bool isReload)
@@ -1152,8 +1148,12 @@ void ConditionMgr::LoadConditions(bool isReload)
         sSpellMgr->UnloadSpellInfoImplicitTargetConditionLists();
     }
 
+    // Ordering by ElseGroup first makes every condition list built below store its else groups contiguously,
+    // which IsObjectMeetToConditionList relies on. Within a group the primary key order is kept.
     QueryResult result = WorldDatabase.Query("SELECT SourceTypeOrReferenceId, SourceGroup, SourceEntry, SourceId, ElseGroup, ConditionTypeOrReference, ConditionTarget, "
-                                             " ConditionValue1, ConditionValue2, ConditionValue3, NegativeCondition, ErrorType, ErrorTextId, ScriptName FROM conditions");
+                                             " ConditionValue1, ConditionValue2, ConditionValue3, NegativeCondition, ErrorType, ErrorTextId, ScriptName FROM conditions "
+                                             "ORDER BY ElseGroup, SourceTypeOrReferenceId, SourceGroup, SourceEntry, SourceId, ConditionTypeOrReference, ConditionTarget, "
+                                             "ConditionValue1, ConditionValue2, ConditionValue3");
 
     if (!result)
     {
@@ -1162,6 +1162,7 @@ void ConditionMgr::LoadConditions(bool isReload)
     }
 
     uint32 count = 0;
+    uint32 lastElseGroup = 0;
 
     do
     {
@@ -1183,6 +1184,10 @@ void ConditionMgr::LoadConditions(bool isReload)
         cond->ErrorTextId                   = fields[12].Get<uint32>();
         cond->ScriptId                      = sObjectMgr->GetScriptId(fields[13].Get<std::string>());
 
+        // lists keep their else groups contiguous only as long as the rows come in ElseGroup order
+        ASSERT(cond->ElseGroup >= lastElseGroup, "ConditionMgr::LoadConditions - conditions not ordered by ElseGroup ({} after {})", cond->ElseGroup, lastElseGroup);
+        lastElseGroup = cond->ElseGroup;
+
         if (iConditionTypeOrReference >= 0)
             cond->ConditionType = ConditionTypes(iConditionTypeOrReference);
 
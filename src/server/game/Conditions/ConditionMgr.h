@@ -21,6 +21,7 @@
 #include "Define.h"
 #include <list>
 #include <map>
+#include <vector>
 
 class Player;
 class Unit;
@@ -112,7 +113,7 @@ enum ConditionTypes
 
     Step 6: Determine how you are going to store your conditions. You need to add a new storage container
             for it in ConditionMgr class, along with a function like:
-            ConditionList GetConditionsForXXXYourNewSourceTypeXXX(parameters...)
+            ConditionList const& GetConditionsForXXXYourNewSourceTypeXXX(parameters...) const
 
             The above function should be placed in upper level (practical) code that actually
             checks the conditions.
@@ -237,7 +238,8 @@ struct Condition
     uint32 GetMaxAvailableConditionTargets();
 };
 
-typedef std::list<Condition*> ConditionList;
+// Conditions sharing an ElseGroup are stored next to each other, see ConditionMgr::LoadConditions
+typedef std::vector<Condition*> ConditionList;
 typedef std::map<uint32, ConditionList> ConditionTypeContainer;
 typedef std::map<ConditionSourceType, ConditionTypeContainer> ConditionContainer;
 typedef std::map<uint32, ConditionTypeContainer> CreatureSpellConditionContainer;
@@ -258,7 +260,7 @@ public:
 
     void LoadConditions(bool isReload = false);
     bool isConditionTypeValid(Condition* cond);
-    ConditionList GetConditionReferences(uint32 refId);
+    ConditionList const& GetConditionReferences(uint32 refId) const;
 
     uint32 GetSearcherTypeMaskForConditionList(ConditionList const& conditions);
     bool IsObjectMeetToConditions(WorldObject* object, ConditionList const& conditions);
@@ -266,12 +268,12 @@ public:
     bool IsObjectMeetToConditions(ConditionSourceInfo& sourceInfo, ConditionList const& conditions);
     [[nodiscard]] bool CanHaveSourceGroupSet(ConditionSourceType sourceType) const;
     [[nodiscard]] bool CanHaveSourceIdSet(ConditionSourceType sourceType) const;
-    ConditionList GetConditionsForNotGroupedEntry(ConditionSourceType sourceType, uint32 entry);
-    ConditionList GetConditionsForSpellClickEvent(uint32 creatureId, uint32 spellId);
-    ConditionList GetConditionsForSmartEvent(int32 entryOrGuid, uint32 eventId, uint32 sourceType);
-    ConditionList GetConditionsForVehicleSpell(uint32 creatureId, uint32 spellId);
-    ConditionList GetConditionsForNpcVendorEvent(uint32 creatureId, uint32 itemId);
-    ConditionList GetConditionsForObjectVisibility(const WorldObject* object) const;
+    ConditionList const& GetConditionsForNotGroupedEntry(ConditionSourceType sourceType, uint32 entry) const;
+    ConditionList const& GetConditionsForSpellClickEvent(uint32 creatureId, uint32 spellId) const;
+    ConditionList const& GetConditionsForSmartEvent(int32 entryOrGuid, uint32 eventId, uint32 sourceType) const;
+    ConditionList const& GetConditionsForVehicleSpell(uint32 creatureId, uint32 spellId) const;
+    ConditionList const& GetConditionsForNpcVendorEvent(uint32 creatureId, uint32 itemId) const;
+    ConditionList const& GetConditionsForObjectVisibility(const WorldObject* object) const;
 
 private:
     bool isSourceTypeValid(Condition* cond);
@@ -79,6 +79,7 @@ Object::Object() : m_PackGUID(sizeof(uint64) + 1)
 
     m_inWorld           = false;
     m_objectUpdated     = false;
+    m_updateQueueSlot   = 0;
 
     sScriptMgr->OnConstructObject(this);
 }
@@ -222,14 +223,13 @@ void Object::BuildCreateUpdateBlockForPlayer(UpdateData* data, Player* target)
         }
     }
 
-    ByteBuffer buf(500);
+    ByteBuffer& buf = data->StartUpdateBlock();
     buf << (uint8)updatetype;
     buf << GetPackGUID();
     buf << (uint8)m_objectTypeId;
 
     BuildMovementUpdate(&buf, flags);
     BuildValuesUpdate(updatetype, &buf, target);
-    data->AddUpdateBlock(buf);
 }
 
 void Object::SendUpdateToPlayer(Player* player)
@@ -245,14 +245,12 @@ void Object::SendUpdateToPlayer(Player* player)
 
 void Object::BuildValuesUpdateBlockForPlayer(UpdateData* data, Player* target)
 {
-    ByteBuffer buf(500);
+    ByteBuffer& buf = data->StartUpdateBlock();
 
     buf << (uint8) UPDATETYPE_VALUES;
     buf << GetPackGUID();
 
     BuildValuesUpdate(UPDATETYPE_VALUES, &buf, target);
-
-    data->AddUpdateBlock(buf);
 }
 
 void Object::BuildOutOfRangeUpdateBlock(UpdateData* data) const
@@ -488,26 +486,55 @@ void Object::BuildValuesUpdate(uint8 updateType, ByteBuffer* data, Player* targe
     if (!target)
         return;
 
-    ByteBuffer fieldBuffer;
+    UpdateFieldFlagMasks const* flagMasks = nullptr;
+    uint32 visibleFlag = GetUpdateFieldData(target, flagMasks);
+
     UpdateMask updateMask;
-    updateMask.SetCount(m_valuesCount);
+    BuildValuesUpdateMask(updateType, visibleFlag, *flagMasks, updateMask);
+
+    *data << uint8(updateMask.GetBlockCount());
+    updateMask.AppendToPacket(data);
+
+    updateMask.ForEachSetBit([&](uint32 index)
+    {
+        *data << m_uint32Values[index];
+    });
+}
 
-    uint32* flags = nullptr;
-    uint32 visibleFlag = GetUpdateFieldData(target, flags);
+void Object::BuildValuesUpdateMask(uint8 updateType, uint32 visibleFlag, UpdateFieldFlagMasks const& flagMasks, UpdateMask& updateMask) const
+{
+    updateMask.SetCount(m_valuesCount);
 
-    for (uint16 index = 0; index < m_valuesCount; ++index)
+    for (uint32 block = 0; block < updateMask.GetBlockCount(); ++block)
     {
-        if (_fieldNotifyFlags & flags[index] ||
-                ((updateType == UPDATETYPE_VALUES ? _changesMask.GetBit(index) : m_uint32Values[index]) && (flags[index] & visibleFlag)))
+        UpdateMask::ClientUpdateMaskType visible = flagMasks.GetBlock(visibleFlag, block);
+        // special info fields are sent to the empathy caster even if unchanged
+        UpdateMask::ClientUpdateMaskType notify = flagMasks.GetBlock(_fieldNotifyFlags | (visibleFlag & UF_FLAG_SPECIAL_INFO), block);
+
+        // the flag tables of items and units also cover containers and players
+        uint32 fieldsLeft = m_valuesCount - block * UpdateMask::CLIENT_UPDATE_MASK_BITS;
+        if (fieldsLeft < UpdateMask::CLIENT_UPDATE_MASK_BITS)
         {
-            updateMask.SetBit(index);
-            fieldBuffer << m_uint32Values[index];
+            UpdateMask::ClientUpdateMaskType const existing = (UpdateMask::ClientUpdateMaskType(1) << fieldsLeft) - 1;
+            visible &= existing;
+            notify &= existing;
         }
-    }
 
-    *data << uint8(updateMask.GetBlockCount());
-    updateMask.AppendToPacket(data);
-    data->append(fieldBuffer);
+        UpdateMask::ClientUpdateMaskType send = 0;
+        if (updateType == UPDATETYPE_VALUES)
+            send = _changesMask.GetBlock(block) & visible;
+        else
+        {
+            for (; visible; visible &= visible - 1)
+            {
+                uint32 bit = std::countr_zero(visible);
+                if (m_uint32Values[block * UpdateMask::CLIENT_UPDATE_MASK_BITS + bit])
+                    send |= UpdateMask::ClientUpdateMaskType(1) << bit;
+            }
+        }
+
+        updateMask.SetBlock(block, send | notify);
+    }
 }
 
 void Object::AddToObjectUpdateIfNeeded()
@@ -523,6 +550,9 @@ void Object::ClearUpdateMask(bool remove)
 {
     _changesMask.Clear();
 
+    // cached values blocks were built from the changes that are sent now
+    InvalidateValuesUpdateCache();
+
     if (m_objectUpdated)
     {
         if (remove)
@@ -533,19 +563,12 @@ void Object::ClearUpdateMask(bool remove)
 
 void Object::BuildFieldsUpdate(Player* player, UpdateDataMapType& data_map)
 {
-    UpdateDataMapType::iterator iter = data_map.find(player);
-
-    if (iter == data_map.end())
-    {
-        std::pair<UpdateDataMapType::iterator, bool> p = data_map.insert(UpdateDataMapType::value_type(player, UpdateData()));
-        ASSERT(p.second);
-        iter = p.first;
-    }
+    UpdateDataMapType::iterator iter = data_map.try_emplace(player).first;
 
     BuildValuesUpdateBlockForPlayer(&iter->second, iter->first);
 }
 
-uint32 Object::GetUpdateFieldData(Player const* target, uint32*& flags) const
+uint32 Object::GetUpdateFieldData(Player const* target, UpdateFieldFlagMasks const*& flagMasks) const
 {
     uint32 visibleFlag = UF_FLAG_PUBLIC;
 
@@ -556,7 +579,7 @@ uint32 Object::GetUpdateFieldData(Player const* target, uint32*& flags) const
     {
         case TYPEID_ITEM:
         case TYPEID_CONTAINER:
-            flags = ItemUpdateFieldFlags;
+            flagMasks = &ItemUpdateFieldFlagMasks;
             if (((Item*)this)->GetOwnerGUID() == target->GetGUID())
                 visibleFlag |= UF_FLAG_OWNER | UF_FLAG_ITEM_OWNER;
             break;
@@ -564,7 +587,7 @@ uint32 Object::GetUpdateFieldData(Player const* target, uint32*& flags) const
         case TYPEID_PLAYER:
             {
                 Player* plr = ToUnit()->GetCharmerOrOwnerPlayerOrPlayerItself();
-                flags = UnitUpdateFieldFlags;
+                flagMasks = &UnitUpdateFieldFlagMasks;
                 if (ToUnit()->GetOwnerGUID() == target->GetGUID())
                     visibleFlag |= UF_FLAG_OWNER;
 
@@ -577,17 +600,17 @@ uint32 Object::GetUpdateFieldData(Player const* target, uint32*& flags) const
                 break;
             }
         case TYPEID_GAMEOBJECT:
-            flags = GameObjectUpdateFieldFlags;
+            flagMasks = &GameObjectUpdateFieldFlagMasks;
             if (ToGameObject()->GetOwnerGUID() == target->GetGUID())
                 visibleFlag |= UF_FLAG_OWNER;
             break;
         case TYPEID_DYNAMICOBJECT:
-            flags = DynamicObjectUpdateFieldFlags;
+            flagMasks = &DynamicObjectUpdateFieldFlagMasks;
             if (((DynamicObject*)this)->GetCasterGUID() == target->GetGUID())
                 visibleFlag |= UF_FLAG_OWNER;
             break;
         case TYPEID_CORPSE:
-            flags = CorpseUpdateFieldFlags;
+            flagMasks = &CorpseUpdateFieldFlagMasks;
             if (ToCorpse()->GetOwnerGUID() == target->GetGUID())
                 visibleFlag |= UF_FLAG_OWNER;
             break;
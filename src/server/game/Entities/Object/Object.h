@@ -43,6 +43,7 @@
 #include "UpdateFields.h"
 
 class ALEEventProcessor;
+class UpdateFieldFlagMasks;
 
 enum TempSummonType
 {
@@ -228,6 +229,10 @@ public:
 
     virtual std::string GetDebugInfo() const;
 
+    // position in the update queue of the map, only meaningful while the object is queued (see Map::AddUpdateObject)
+    [[nodiscard]] std::size_t GetUpdateQueueSlot() const { return m_updateQueueSlot; }
+    void SetUpdateQueueSlot(std::size_t slot) { m_updateQueueSlot = slot; }
+
     DataMap CustomData;
 
     template<typename... T>
@@ -239,12 +244,16 @@ public:
 protected:
     Object();
 
+    virtual void InvalidateValuesUpdateCache() { }
+
     void _InitValues();
     void _Create(ObjectGuid::LowType guidlow, uint32 entry, HighGuid guidhigh);
     [[nodiscard]] std::string _ConcatFields(uint16 startIndex, uint16 size) const;
     bool _LoadIntoDataField(std::string const& data, uint32 startOffset, uint32 count);
 
-    uint32 GetUpdateFieldData(Player const* target, uint32*& flags) const;
+    uint32 GetUpdateFieldData(Player const* target, UpdateFieldFlagMasks const*& flagMasks) const;
+    // notified and special info fields, and the visible ones that changed (values update) or are set (create)
+    void BuildValuesUpdateMask(uint8 updateType, uint32 visibleFlag, UpdateFieldFlagMasks const& flagMasks, UpdateMask& updateMask) const;
 
     void BuildMovementUpdate(ByteBuffer* data, uint16 flags) const;
     virtual void BuildValuesUpdate(uint8 updateType, ByteBuffer* data, Player* target);
@@ -275,6 +284,7 @@ protected:
 
 private:
     bool m_inWorld;
+    std::size_t m_updateQueueSlot;
 
     PackedGuid m_PackGUID;
 
@@ -56,6 +56,8 @@ public:
     void AddOutOfRangeGUID(ObjectGuid guid);
     void AddUpdateBlock(const ByteBuffer& block);
     void AddUpdateBlock(const UpdateData& block);
+    // the returned buffer is the packet data, the caller appends exactly one block to it
+    ByteBuffer& StartUpdateBlock();
     bool BuildPacket(WorldPacket& packet);
     [[nodiscard]] bool HasData() const { return m_blockCount > 0 || !m_outOfRangeGUIDs.empty(); }
     void Clear();
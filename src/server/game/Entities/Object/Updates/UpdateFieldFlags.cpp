@@ -1566,3 +1566,22 @@ uint32 CorpseUpdateFieldFlags[CORPSE_END] =
     UF_FLAG_DYNAMIC,                                        // CORPSE_FIELD_DYNAMIC_FLAGS
     UF_FLAG_NONE,                                           // CORPSE_FIELD_PAD
 };
+
+UpdateFieldFlagMasks::UpdateFieldFlagMasks(uint32 const* flags, uint32 count) :
+    _blocks(((count + UpdateMask::CLIENT_UPDATE_MASK_BITS - 1) / UpdateMask::CLIENT_UPDATE_MASK_BITS) * UF_FLAG_COUNT, 0)
+{
+    for (uint32 index = 0; index < count; ++index)
+    {
+        uint32 block = index / UpdateMask::CLIENT_UPDATE_MASK_BITS;
+        for (uint32 flag = 0; flag < UF_FLAG_COUNT; ++flag)
+            if (flags[index] & (1 << flag))
+                _blocks[block * UF_FLAG_COUNT + flag] |= UpdateMask::ClientUpdateMaskType(1) << (index % UpdateMask::CLIENT_UPDATE_MASK_BITS);
+    }
+}
+
+// defined after the flag tables, they are built from them during static initialization
+UpdateFieldFlagMasks const ItemUpdateFieldFlagMasks(ItemUpdateFieldFlags, CONTAINER_END);
+UpdateFieldFlagMasks const UnitUpdateFieldFlagMasks(UnitUpdateFieldFlags, PLAYER_END);
+UpdateFieldFlagMasks const GameObjectUpdateFieldFlagMasks(GameObjectUpdateFieldFlags, GAMEOBJECT_END);
+UpdateFieldFlagMasks const DynamicObjectUpdateFieldFlagMasks(DynamicObjectUpdateFieldFlags, DYNAMICOBJECT_END);
+UpdateFieldFlagMasks const CorpseUpdateFieldFlagMasks(CorpseUpdateFieldFlags, CORPSE_END);
@@ -20,6 +20,8 @@
 
 #include "Define.h"
 #include "UpdateFields.h"
+#include "UpdateMask.h"
+#include <vector>
 
 enum UpdatefieldFlags
 {
@@ -33,6 +35,8 @@ enum UpdatefieldFlags
     UF_FLAG_PARTY_MEMBER = 0x040,
     UF_FLAG_UNUSED2      = 0x080,
     UF_FLAG_DYNAMIC      = 0x100,
+
+    UF_FLAG_COUNT        = 9
 };
 
 extern uint32 ItemUpdateFieldFlags[CONTAINER_END];
@@ -41,4 +45,31 @@ extern uint32 GameObjectUpdateFieldFlags[GAMEOBJECT_END];
 extern uint32 DynamicObjectUpdateFieldFlags[DYNAMICOBJECT_END];
 extern uint32 CorpseUpdateFieldFlags[CORPSE_END];
 
+/// The fields carrying each update field flag, in the block layout of UpdateMask.
+/// Lets values updates pick their fields 32 at a time instead of testing every field.
+class UpdateFieldFlagMasks
+{
+public:
+    UpdateFieldFlagMasks(uint32 const* flags, uint32 count);
+
+    /// Fields of the block having any of the flags
+    [[nodiscard]] UpdateMask::ClientUpdateMaskType GetBlock(uint32 flags, uint32 block) const
+    {
+        UpdateMask::ClientUpdateMaskType bits = 0;
+        for (flags &= (1 << UF_FLAG_COUNT) - 1; flags; flags &= flags - 1)
+            bits |= _blocks[block * UF_FLAG_COUNT + std::countr_zero(flags)];
+
+        return bits;
+    }
+
+private:
+    std::vector<UpdateMask::ClientUpdateMaskType> _blocks;
+};
+
+extern UpdateFieldFlagMasks const ItemUpdateFieldFlagMasks;
+extern UpdateFieldFlagMasks const UnitUpdateFieldFlagMasks;
+extern UpdateFieldFlagMasks const GameObjectUpdateFieldFlagMasks;
+extern UpdateFieldFlagMasks const DynamicObjectUpdateFieldFlagMasks;
+extern UpdateFieldFlagMasks const CorpseUpdateFieldFlagMasks;
+
 #endif // _UPDATEFIELDFLAGS_H
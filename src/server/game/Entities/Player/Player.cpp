@@ -65,6 +65,7 @@
 #include "OutdoorPvPMgr.h"
 #include "Pet.h"
 #include "PetitionMgr.h"
+#include "PlayerLoginCache.h"
 #include "QuestDef.h"
 #include "RBAC.h"
 #include "Realm.h"
@@ -87,6 +88,7 @@
 #include "Util.h"
 #include "Vehicle.h"
 #include "Weather.h"
+#include "WhoListCacheMgr.h"
 #include "World.h"
 #include "WorldPacket.h"
 #include "WorldSession.h"
@@ -1705,10 +1707,14 @@ void Player::AddToWorld()
     for (uint8 i = PLAYER_SLOT_START; i < PLAYER_SLOT_END; ++i)
         if (m_items[i])
             m_items[i]->AddToWorld();
+
+    sWhoListCacheMgr->MarkDirty(GetGUID());
 }
 
 void Player::RemoveFromWorld()
 {
+    sWhoListCacheMgr->MarkDirty(GetGUID());
+
     // cleanup
     if (IsInWorld())
     {
@@ -2257,6 +2263,14 @@ void Player::SetGameMaster(bool on)
     UpdateObjectVisibility();
 }
 
+void Player::SetInGuild(uint32 GuildId)
+{
+    SetUInt32Value(PLAYER_GUILDID, GuildId);
+    // xinef: update global storage
+    sCharacterCache->UpdateCharacterGuildId(GetGUID(), GetGuildId());
+    sWhoListCacheMgr->MarkDirty(GetGUID());
+}
+
 void Player::SetGMVisible(bool on)
 {
     const uint32 VISUAL_AURA = 37800;
@@ -4064,11 +4078,14 @@ void Player::DeleteFromDB(ObjectGuid::LowType lowGuid, uint32 accountId, bool up
                 {
                     do
                     {
-                        if (Player* pFriend = ObjectAccessor::FindPlayerByLowGUID((*resultFriends)[0].Get<uint32>()))
+                        ObjectGuid::LowType friendLowGuid = (*resultFriends)[0].Get<uint32>();
+                        if (Player* pFriend = ObjectAccessor::FindPlayerByLowGUID(friendLowGuid))
                         {
                             pFriend->GetSocial()->RemoveFromSocialList(playerGuid, SOCIAL_FLAG_ALL);
                             sSocialMgr->SendFriendStatus(pFriend, FRIEND_REMOVED, playerGuid, false);
                         }
+                        else // the rows of offline characters go with CHAR_DEL_CHAR_SOCIAL_BY_FRIEND below
+                            sPlayerLoginCache->Invalidate(ObjectGuid::Create<HighGuid::Player>(friendLowGuid));
                     } while (resultFriends->NextRow());
                 }
 
@@ -4241,6 +4258,9 @@ void Player::DeleteFromDB(ObjectGuid::LowType lowGuid, uint32 accountId, bool up
                 stmt->SetData(0, lowGuid);
 
                 CharacterDatabase.Execute(stmt);
+
+                // unlinked characters drop out of the friend lists of everyone who had them
+                sPlayerLoginCache->InvalidateAll();
                 break;
             }
         default:
@@ -4511,6 +4531,7 @@ void Player::OfflineResurrect(ObjectGuid const& guid, CharacterDatabaseTransacti
     stmt->SetData(0, uint16(AT_LOGIN_RESURRECT));
     stmt->SetData(1, guid.GetCounter());
     CharacterDatabase.ExecuteOrAppend(trans, stmt);
+    sPlayerLoginCache->Invalidate(guid);
 }
 
 Corpse* Player::CreateCorpse()
@@ -9678,7 +9699,7 @@ void Player::VehicleSpellInitialize()
             continue;
         }
 
-        ConditionList conditions = sConditionMgr->GetConditionsForVehicleSpell(vehicle->GetEntry(), spellId);
+        ConditionList const& conditions = sConditionMgr->GetConditionsForVehicleSpell(vehicle->GetEntry(), spellId);
         if (!sConditionMgr->IsObjectMeetToConditions(this, vehicle, conditions))
         {
             LOG_DEBUG("condition", "VehicleSpellInitialize: conditions not met for Vehicle entry {} spell {}", vehicle->ToCreature()->GetEntry(), spellId);
@@ -10741,7 +10762,7 @@ bool Player::BuyItemFromVendorSlot(ObjectGuid vendorguid, uint32 vendorslot, uin
         return false;
     }
 
-    ConditionList conditions = sConditionMgr->GetConditionsForNpcVendorEvent(creature->GetEntry(), item);
+    ConditionList const& conditions = sConditionMgr->GetConditionsForNpcVendorEvent(creature->GetEntry(), item);
     if (!sConditionMgr->IsObjectMeetToConditions(this, creature, conditions))
     {
         //LOG_DEBUG("condition", "BuyItemFromVendor: conditions not met for creature entry {} item {}", creature->GetEntry(), item);
@@ -14415,7 +14436,7 @@ bool Player::CanSeeSpellClickOn(Creature const* c) const
         if (!itr->second.IsFitToRequirements(this, c))
             return false;
 
-        ConditionList conds = sConditionMgr->GetConditionsForSpellClickEvent(c->GetEntry(), itr->second.spellId);
+        ConditionList const& conds = sConditionMgr->GetConditionsForSpellClickEvent(c->GetEntry(), itr->second.spellId);
         ConditionSourceInfo info = ConditionSourceInfo(const_cast<Player*>(this), const_cast<Creature*>(c));
         if (sConditionMgr->IsObjectMeetToConditions(info, conds))
             return true;
@@ -14429,7 +14450,7 @@ bool Player::CanSeeObjectByVisibilityConditions(WorldObject const* object) const
     if (IsGameMaster())
         return true;
 
-    ConditionList conds = sConditionMgr->GetConditionsForObjectVisibility(object);
+    ConditionList const& conds = sConditionMgr->GetConditionsForObjectVisibility(object);
     ConditionSourceInfo info = ConditionSourceInfo(const_cast<Player*>(this), const_cast<WorldObject*>(object));
     return sConditionMgr->IsObjectMeetToConditions(info, conds);
 }
@@ -14506,7 +14527,7 @@ bool Player::CanSeeVendor(Creature const* creature) const
     if (!creature->HasNpcFlag(UNIT_NPC_FLAG_VENDOR))
         return true;
 
-    ConditionList conditions = sConditionMgr->GetConditionsForNpcVendorEvent(creature->GetEntry(), 0);
+    ConditionList const& conditions = sConditionMgr->GetConditionsForNpcVendorEvent(creature->GetEntry(), 0);
     if (!sConditionMgr->IsObjectMeetToConditions(const_cast<Player*>(this), const_cast<Creature*>(creature), conditions))
         return false;
 
@@ -15579,6 +15600,9 @@ void Player::SendDuelCountdown(uint32 counter)
 
 void Player::SetIsSpectator(bool on)
 {
+    // spectators are listed in Dalaran
+    sWhoListCacheMgr->MarkDirty(GetGUID());
+
     if (on)
     {
         AddAura(SPECTATOR_SPELL_SPEED, this);
@@ -16380,6 +16404,9 @@ void Player::SetServerSideVisibility(ServerSideVisibilityType type, AccountTypes
     sScriptMgr->OnPlayerSetServerSideVisibility(this, type, sec);
 
     m_serverSideVisibility.SetValue(type, sec);
+
+    if (type == SERVERSIDE_VISIBILITY_GM)
+        sWhoListCacheMgr->MarkDirty(GetGUID());
 }
 
 void Player::SetServerSideVisibilityDetect(ServerSideVisibilityType type, AccountTypes sec)
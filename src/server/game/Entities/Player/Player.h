@@ -1118,6 +1118,8 @@ public:
     bool Create(ObjectGuid::LowType guidlow, CharacterCreateInfo* createInfo);
 
     void Update(uint32 time) override;
+    // housekeeping counted in game time seconds, called once per second from Update
+    void UpdateSecondTimers(time_t now);
 
     PlayerFlags GetPlayerFlags() const { return PlayerFlags(GetUInt32Value(PLAYER_FLAGS)); }
     bool HasPlayerFlag(PlayerFlags flags) const { return HasFlag(PLAYER_FLAGS, flags) != 0; }
@@ -1909,12 +1911,7 @@ public:
     void RemoveFromGroup(RemoveMethod method = GROUP_REMOVEMETHOD_DEFAULT) { RemoveFromGroup(GetGroup(), GetGUID(), method); }
     void SendUpdateToOutOfRangeGroupMembers();
 
-    void SetInGuild(uint32 GuildId)
-    {
-        SetUInt32Value(PLAYER_GUILDID, GuildId);
-        // xinef: update global storage
-        sCharacterCache->UpdateCharacterGuildId(GetGUID(), GetGuildId());
-    }
+    void SetInGuild(uint32 GuildId);
     void SetRank(uint8 rankId) { SetUInt32Value(PLAYER_GUILDRANK, rankId); }
     [[nodiscard]] uint8 GetRank() const { return uint8(GetUInt32Value(PLAYER_GUILDRANK)); }
     void SetGuildIdInvited(uint32 GuildId) { m_GuildIdInvited = GuildId; }
@@ -20,6 +20,7 @@
 #include "InstancePackets.h"
 #include "MapMgr.h"
 #include "Player.h"
+#include "PlayerLoginCache.h"
 #include "RBAC.h"
 #include "ScriptMgr.h"
 #include "WorldSession.h"
@@ -96,6 +97,8 @@ void Player::SavePositionInDB(uint32 mapid, float x, float y, float z, float o,
     stmt->SetData(6, guid.GetCounter());
 
     CharacterDatabase.Execute(stmt);
+
+    sPlayerLoginCache->Invalidate(guid);
 }
 
 void Player::SavePositionInDB(WorldLocation const& loc, uint16 zoneId, ObjectGuid guid, CharacterDatabaseTransaction trans)
@@ -111,6 +114,8 @@ void Player::SavePositionInDB(WorldLocation const& loc, uint16 zoneId, ObjectGui
     stmt->SetData(6, guid.GetCounter());
 
     CharacterDatabase.ExecuteOrAppend(trans, stmt);
+
+    sPlayerLoginCache->Invalidate(guid);
 }
 
 void Player::Customize(CharacterCustomizeInfo const* customizeInfo, CharacterDatabaseTransaction trans)
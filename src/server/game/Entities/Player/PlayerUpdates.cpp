@@ -38,6 +38,7 @@
 #include "Vehicle.h"
 #include "Weather.h"
 #include "WeatherMgr.h"
+#include "WhoListCacheMgr.h"
 #include "WorldState.h"
 #include "WorldStatePackets.h"
 
@@ -79,17 +80,14 @@ void Player::Update(uint32 p_time)
 
     time_t now = GameTime::GetGameTime().count();
 
-    UpdatePvPFlag(now);
-    UpdateFFAPvPFlag(now);
+    // timers counted in game time seconds can only expire when the second changes
+    if (now > m_Last_tick)
+        UpdateSecondTimers(now);
 
     UpdateContestedPvP(p_time);
 
-    UpdateDuelFlag(now);
-
     CheckDuelDistance(now);
 
-    UpdateAfkReport(now);
-
     // Xinef: update charm AI only if we are controlled by creature or
     // non-posses player charm
     if (IsCharmed() && !HasUnitFlag(UNIT_FLAG_POSSESSED))
@@ -104,36 +102,6 @@ void Player::Update(uint32 p_time)
         }
     }
 
-    time_t lastTick = m_Last_tick;
-    if (now > m_Last_tick)
-    {
-        // Update items that have just a limited lifetime
-        UpdateItemDuration(uint32(now - m_Last_tick));
-
-        // check every minute, less chance to crash and wont break anything.
-        UpdateSoulboundTradeItems();
-
-        // Played time
-        uint32 elapsed = uint32(now - m_Last_tick);
-        m_Played_time[PLAYED_TIME_TOTAL] += elapsed; // Total played time
-        m_Played_time[PLAYED_TIME_LEVEL] += elapsed; // Level played time
-        GetSession()->SetTotalTime(GetSession()->GetTotalTime() + elapsed);
-        m_Last_tick = now;
-    }
-
-    // If mute expired, remove it from the DB
-    if (GetSession()->m_muteTime && GetSession()->m_muteTime < now)
-    {
-        GetSession()->m_muteTime = 0;
-        LoginDatabasePreparedStatement* stmt =
-            LoginDatabase.GetPreparedStatement(LOGIN_UPD_MUTE_TIME);
-        stmt->SetData(0, 0); // Set the mute time to 0
-        stmt->SetData(1, "");
-        stmt->SetData(2, "");
-        stmt->SetData(3, GetSession()->GetAccountId());
-        LoginDatabase.Execute(stmt);
-    }
-
     if (!m_timedquests.empty())
     {
         QuestSet::iterator iter = m_timedquests.begin();
@@ -236,27 +204,6 @@ void Player::Update(uint32 p_time)
         }
     }
 
-    if (HasPlayerFlag(PLAYER_FLAGS_RESTING))
-    {
-        if (now > lastTick && _restTime > 0) // freeze update
-        {
-            time_t currTime = GameTime::GetGameTime().count();
-            time_t timeDiff = currTime - _restTime;
-            if (timeDiff >= 10) // freeze update
-            {
-                _restTime = currTime;
-
-                float bubble = 0.125f * sWorld->getRate(RATE_REST_INGAME);
-                float extraPerSec =
-                    ((float) GetUInt32Value(PLAYER_NEXT_LEVEL_XP) / 72000.0f) *
-                    bubble;
-
-                // speed collect rest bonus (section/in hour)
-                SetRestBonus(GetRestBonus() + timeDiff * extraPerSec);
-            }
-        }
-    }
-
     if (m_weaponChangeTimer > 0)
     {
         if (p_time >= m_weaponChangeTimer)
@@ -372,18 +319,6 @@ void Player::Update(uint32 p_time)
     UpdateEnchantTime(p_time);
     UpdateHomebindTime(p_time);
 
-    if (!_instanceResetTimes.empty())
-    {
-        for (InstanceTimeMap::iterator itr = _instanceResetTimes.begin();
-             itr != _instanceResetTimes.end();)
-        {
-            if (itr->second < now)
-                _instanceResetTimes.erase(itr++);
-            else
-                ++itr;
-        }
-    }
-
     // group update
     SendUpdateToOutOfRangeGroupMembers();
 
@@ -424,6 +359,68 @@ void Player::Update(uint32 p_time)
     }
 }
 
+void Player::UpdateSecondTimers(time_t now)
+{
+    uint32 elapsed = uint32(now - m_Last_tick);
+
+    UpdatePvPFlag(now);
+    UpdateFFAPvPFlag(now);
+
+    UpdateDuelFlag(now);
+
+    UpdateAfkReport(now);
+
+    // Update items that have just a limited lifetime
+    UpdateItemDuration(elapsed);
+
+    // check every minute, less chance to crash and wont break anything.
+    UpdateSoulboundTradeItems();
+
+    // Played time
+    m_Played_time[PLAYED_TIME_TOTAL] += elapsed; // Total played time
+    m_Played_time[PLAYED_TIME_LEVEL] += elapsed; // Level played time
+    GetSession()->SetTotalTime(GetSession()->GetTotalTime() + elapsed);
+    m_Last_tick = now;
+
+    // If mute expired, remove it from the DB
+    if (GetSession()->m_muteTime && GetSession()->m_muteTime < now)
+    {
+        GetSession()->m_muteTime = 0;
+        LoginDatabasePreparedStatement* stmt =
+            LoginDatabase.GetPreparedStatement(LOGIN_UPD_MUTE_TIME);
+        stmt->SetData(0, 0); // Set the mute time to 0
+        stmt->SetData(1, "");
+        stmt->SetData(2, "");
+        stmt->SetData(3, GetSession()->GetAccountId());
+        LoginDatabase.Execute(stmt);
+    }
+
+    if (HasPlayerFlag(PLAYER_FLAGS_RESTING) && _restTime > 0) // freeze update
+    {
+        time_t timeDiff = now - _restTime;
+        if (timeDiff >= 10) // freeze update
+        {
+            _restTime = now;
+
+            float bubble = 0.125f * sWorld->getRate(RATE_REST_INGAME);
+            float extraPerSec =
+                ((float) GetUInt32Value(PLAYER_NEXT_LEVEL_XP) / 72000.0f) *
+                bubble;
+
+            // speed collect rest bonus (section/in hour)
+            SetRestBonus(GetRestBonus() + timeDiff * extraPerSec);
+        }
+    }
+
+    for (InstanceTimeMap::iterator itr = _instanceResetTimes.begin(); itr != _instanceResetTimes.end();)
+    {
+        if (itr->second < now)
+            _instanceResetTimes.erase(itr++);
+        else
+            ++itr;
+    }
+}
+
 void Player::UpdateMirrorTimers()
 {
     // Desync flags for update on next HandleDrowning
@@ -1271,6 +1268,8 @@ void Player::UpdateZone(uint32 newZone, uint32 newArea, bool force)
                                       // just area change, works strange...
         if (Guild* guild = GetGuild())
             guild->UpdateMemberData(this, GUILD_MEMBER_DATA_ZONEID, newZone);
+
+        sWhoListCacheMgr->MarkDirty(GetGUID());
     }
 
     GetMap()->UpdatePlayerZoneStats(m_zoneUpdateId, newZone);
@@ -1815,7 +1814,7 @@ void Player::UpdateForQuestWorldObjects()
                 {
                     //! This code doesn't look right, but it was logically converted to condition system to do the exact
                     //! same thing it did before. It definitely needs to be overlooked for intended functionality.
-                    ConditionList conds = sConditionMgr->GetConditionsForSpellClickEvent(obj->GetEntry(), _itr->second.spellId);
+                    ConditionList const& conds = sConditionMgr->GetConditionsForSpellClickEvent(obj->GetEntry(), _itr->second.spellId);
                     bool buildUpdateBlock = false;
                     for (ConditionList::const_iterator jtr = conds.begin(); jtr != conds.end() && !buildUpdateBlock; ++jtr)
                         if ((*jtr)->ConditionType == CONDITION_QUESTREWARDED || (*jtr)->ConditionType == CONDITION_QUESTTAKEN)
@@ -132,7 +132,7 @@ void MotionTransport::BuildUpdate(UpdateDataMapType& data_map)
     for (Map::PlayerList::const_iterator itr = players.begin(); itr != players.end(); ++itr)
         BuildFieldsUpdate(itr->GetSource(), data_map);
 
-    ClearUpdateMask(true);
+    ClearUpdateMask(false);
 }
 
 void MotionTransport::Update(uint32 diff)
@@ -625,6 +625,9 @@ void MotionTransport::DelayedTeleportTransport()
 
 void MotionTransport::UpdatePassengerPositions(PassengerSet& passengers)
 {
+    // passengers keep their transport offset, the world position only changes with the transport
+    PassengerTransform const transform = GetPassengerTransform();
+
     for (PassengerSet::iterator itr = passengers.begin(); itr != passengers.end(); ++itr)
     {
         WorldObject* passenger = *itr;
@@ -640,7 +643,7 @@ void MotionTransport::UpdatePassengerPositions(PassengerSet& passengers)
         // Do not use Unit::UpdatePosition here, we don't want to remove auras as if regular movement occurred
         float x, y, z, o;
         passenger->m_movementInfo.transport.pos.GetPosition(x, y, z, o);
-        CalculatePassengerPosition(x, y, z, &o);
+        transform.Apply(x, y, z, &o);
 
         // check if position is valid
         if (!Acore::IsValidMapCoord(x, y, z))
@@ -651,10 +654,10 @@ void MotionTransport::UpdatePassengerPositions(PassengerSet& passengers)
             case TYPEID_UNIT:
                 {
                     Creature* creature = passenger->ToCreature();
-                    GetMap()->CreatureRelocation(creature, x, y, z, o);
+                    GetMap()->CreatureRelocation(creature, x, y, z, o, false);
 
                     creature->GetTransportHomePosition(x, y, z, o);
-                    CalculatePassengerPosition(x, y, z, &o);
+                    transform.Apply(x, y, z, &o);
                     creature->SetHomePosition(x, y, z, o);
                 }
                 break;
@@ -862,7 +865,7 @@ void StaticTransport::BuildUpdate(UpdateDataMapType& data_map)
     for (Map::PlayerList::const_iterator itr = players.begin(); itr != players.end(); ++itr)
         BuildFieldsUpdate(itr->GetSource(), data_map);
 
-    ClearUpdateMask(true);
+    ClearUpdateMask(false);
 }
 
 void StaticTransport::Update(uint32 diff)
@@ -978,6 +981,8 @@ void StaticTransport::UpdatePosition(float x, float y, float z, float o)
 
 void StaticTransport::UpdatePassengerPositions()
 {
+    PassengerTransform const transform = GetPassengerTransform();
+
     for (PassengerSet::iterator itr = _passengers.begin(); itr != _passengers.end(); ++itr)
     {
         WorldObject* passenger = *itr;
@@ -990,7 +995,7 @@ void StaticTransport::UpdatePassengerPositions()
         // Do not use Unit::UpdatePosition here, we don't want to remove auras as if regular movement occurred
         float x, y, z, o;
         passenger->m_movementInfo.transport.pos.GetPosition(x, y, z, o);
-        CalculatePassengerPosition(x, y, z, &o);
+        transform.Apply(x, y, z, &o);
 
         // check if position is valid
         if (!Acore::IsValidMapCoord(x, y, z))
@@ -999,7 +1004,7 @@ void StaticTransport::UpdatePassengerPositions()
         switch (passenger->GetTypeId())
         {
             case TYPEID_UNIT:
-                GetMap()->CreatureRelocation(passenger->ToCreature(), x, y, z, o);
+                GetMap()->CreatureRelocation(passenger->ToCreature(), x, y, z, o, false);
                 break;
             case TYPEID_PLAYER:
                 if (passenger->IsInWorld())
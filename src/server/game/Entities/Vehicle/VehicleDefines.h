@@ -139,6 +139,28 @@ public:
     /// This method transforms supplied global coordinates into local offsets
     virtual void CalculatePassengerOffset(float& x, float& y, float& z, float* o = nullptr) const = 0;
 
+    /// Transport position with its rotation computed once, to place many passengers for the same transport position
+    struct PassengerTransform
+    {
+        PassengerTransform(float transX, float transY, float transZ, float transO)
+            : X(transX), Y(transY), Z(transZ), O(transO), Cos(std::cos(transO)), Sin(std::sin(transO)) { }
+
+        /// Same as CalculatePassengerPosition
+        void Apply(float& x, float& y, float& z, float* o = nullptr) const
+        {
+            float inx = x, iny = y;
+            if (o)
+                *o = Position::NormalizeOrientation(O + *o);
+
+            x = X + inx * Cos - iny * Sin;
+            y = Y + iny * Cos + inx * Sin;
+            z = Z + z;
+        }
+
+        float X, Y, Z, O;
+        float Cos, Sin;
+    };
+
 protected:
     static void CalculatePassengerPosition(float& x, float& y, float& z, float* o, float transX, float transY, float transZ, float transO)
     {
@@ -1391,23 +1391,11 @@ void GameEventMgr::UpdateEventNPCFlags(uint16 eventId)
 
     for (auto const& p : creaturesByMap)
     {
-        sMapMgr->DoForAllMapsWithMapId(p.first, [this, &p](Map* map)
+        // applied by the map after the spawn changes queued before
+        sMapMgr->DoForAllMapsWithMapId(p.first, [&p](Map* map)
         {
             for (auto& spawnId : p.second)
-            {
-                auto creatureBounds = map->GetCreatureBySpawnIdStore().equal_range(spawnId);
-                for (auto itr = creatureBounds.first; itr != creatureBounds.second; ++itr)
-                {
-                    Creature* creature = itr->second;
-                    uint32 npcflag = GetNPCFlag(creature);
-                    if (CreatureTemplate const* creatureTemplate = creature->GetCreatureTemplate())
-                        npcflag |= creatureTemplate->npcflag;
-
-                    creature->ReplaceAllNpcFlags(NPCFlags(npcflag));
-                    // reset gossip options, since the flag change might have added / removed some
-                    //cr->ResetGossipOptions();
-                }
-            }
+                map->AddGameEventTask(Map::GameEventTaskType::UpdateNpcFlags, spawnId);
         });
     }
 }
@@ -1453,11 +1441,7 @@ void GameEventMgr::GameEventSpawn(int16 eventId)
             Map* map = sMapMgr->CreateBaseMap(data->mapid);
             // We use spawn coords to spawn
             if (!map->Instanceable() && map->IsGridLoaded(data->posX, data->posY))
-            {
-                Creature* creature = new Creature;
-                if (!creature->LoadCreatureFromDB(*itr, map))
-                    delete creature;
-            }
+                map->AddGameEventTask(Map::GameEventTaskType::SpawnCreature, *itr);
         }
     }
 
@@ -1479,17 +1463,7 @@ void GameEventMgr::GameEventSpawn(int16 eventId)
             Map* map = sMapMgr->CreateBaseMap(data->mapid);
             // We use current coords to unspawn, not spawn coords since creature can have changed grid
             if (!map->Instanceable() && map->IsGridLoaded(data->posX, data->posY))
-            {
-                GameObject* pGameobject = sObjectMgr->IsGameObjectStaticTransport(data->id) ? new StaticTransport() : new GameObject();
-                //TODO: find out when it is add to map
-                if (!pGameobject->LoadGameObjectFromDB(*itr, map, false))
-                    delete pGameobject;
-                else
-                {
-                    if (pGameobject->isSpawnedByDefault())
-                        map->AddToMap(pGameobject);
-                }
-            }
+                map->AddGameEventTask(Map::GameEventTaskType::SpawnGameObject, *itr);
         }
     }
 
@@ -1528,13 +1502,7 @@ void GameEventMgr::GameEventUnspawn(int16 eventId)
 
             sMapMgr->DoForAllMapsWithMapId(data->mapid, [&itr](Map* map)
             {
-                auto creatureBounds = map->GetCreatureBySpawnIdStore().equal_range(*itr);
-                for (auto itr2 = creatureBounds.first; itr2 != creatureBounds.second;)
-                {
-                    Creature* creature = itr2->second;
-                    ++itr2;
-                    creature->AddObjectToRemoveList();
-                }
+                map->AddGameEventTask(Map::GameEventTaskType::DespawnCreature, *itr);
             });
         }
     }
@@ -1558,13 +1526,7 @@ void GameEventMgr::GameEventUnspawn(int16 eventId)
 
             sMapMgr->DoForAllMapsWithMapId(data->mapid, [&itr](Map* map)
             {
-                auto gameobjectBounds = map->GetGameObjectBySpawnIdStore().equal_range(*itr);
-                for (auto itr2 = gameobjectBounds.first; itr2 != gameobjectBounds.second;)
-                {
-                    GameObject* go = itr2->second;
-                    ++itr2;
-                    go->AddObjectToRemoveList();
-                }
+                map->AddGameEventTask(Map::GameEventTaskType::DespawnGameObject, *itr);
             });
         }
     }
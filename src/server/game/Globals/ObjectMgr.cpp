@@ -37,6 +37,7 @@
 #include "Log.h"
 #include "MapMgr.h"
 #include "Pet.h"
+#include "PlayerLoginCache.h"
 #include "PoolMgr.h"
 #include "RaceMgr.h"
 #include "ReputationMgr.h"
@@ -6859,6 +6860,8 @@ void ObjectMgr::ReturnOrDeleteOldMails(bool serverUp)
             continue;
         }
 
+        sPlayerLoginCache->Invalidate(ObjectGuid::Create<HighGuid::Player>(m->receiver));
+
         // Delete or return mail
         if (has_items)
         {
@@ -6904,6 +6907,8 @@ void ObjectMgr::ReturnOrDeleteOldMails(bool serverUp)
                     CharacterDatabase.Execute(stmt);
                 }
 
+                sPlayerLoginCache->Invalidate(ObjectGuid::Create<HighGuid::Player>(m->sender));
+
                 // xinef: update global data
                 sCharacterCache->IncreaseCharacterMailCount(ObjectGuid(HighGuid::Player, m->sender));
                 sCharacterCache->DecreaseCharacterMailCount(ObjectGuid(HighGuid::Player, m->receiver));
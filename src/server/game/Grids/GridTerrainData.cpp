@@ -3,12 +3,33 @@
 #include "GridTerrainData.h"
 #include "Log.h"
 #include "MapDefines.h"
+#include <algorithm>
 #include <filesystem>
+#include <type_traits>
 #include <G3D/Ray.h>
 
 uint16 const holetab_h[4] = { 0x1111, 0x2222, 0x4444, 0x8888 };
 uint16 const holetab_v[4] = { 0x000F, 0x00F0, 0x0F00, 0xF000 };
 
+namespace
+{
+    // Same triangles as getHeightFromFloat/Uint16/Uint8, picked with selects instead of branches:
+    // every corner is loaded and the coefficients of the triangle holding the point are kept,
+    // so a loop over many points has no unpredictable branch and can be vectorized.
+    template<class T>
+    inline float InterpolateCellHeight(float x, float y, T h1, T h2, T h3, T h4, T h5)
+    {
+        bool const nearH1 = x + y < 1;
+        bool const nearH2 = x > y;
+
+        T a = nearH1 ? (nearH2 ? h2 - h1 : h5 - h1 - h3) : (nearH2 ? h2 + h4 - h5 : h4 - h3);
+        T b = nearH1 ? (nearH2 ? h5 - h1 - h2 : h3 - h1) : (nearH2 ? h4 - h2 : h3 + h4 - h5);
+        T c = nearH1 ? h1 : h5 - h4;
+
+        return a * x + b * y + c;
+    }
+}
+
 GridTerrainData::GridTerrainData()
 {
     _gridGetHeight = &GridTerrainData::getHeightFromFlat;
@@ -459,6 +480,64 @@ float GridTerrainData::getHeightFromUint16(float x, float y) const
     return (float)((a * x) + (b * y) + c) * _loadedHeightData->uint16HeightData->gridIntHeightMultiplier + _loadedHeightData->gridHeight;
 }
 
+void GridTerrainData::getHeights(float const* x, float const* y, float* heights, std::size_t count) const
+{
+    if (!_loadedHeightData)
+    {
+        std::fill_n(heights, count, INVALID_HEIGHT);
+        return;
+    }
+
+    // the storage format is resolved once for all points instead of once per point
+    if (_loadedHeightData->uint16HeightData)
+        getHeightsFromGrid(*_loadedHeightData->uint16HeightData, x, y, heights, count);
+    else if (_loadedHeightData->uint8HeightData)
+        getHeightsFromGrid(*_loadedHeightData->uint8HeightData, x, y, heights, count);
+    else if (_loadedHeightData->floatHeightData)
+        getHeightsFromGrid(*_loadedHeightData->floatHeightData, x, y, heights, count);
+    else
+        std::fill_n(heights, count, _loadedHeightData->gridHeight);
+}
+
+template<class HeightData>
+void GridTerrainData::getHeightsFromGrid(HeightData const& heightData, float const* x, float const* y, float* heights, std::size_t count) const
+{
+    using HeightType = std::conditional_t<std::is_same_v<typename HeightData::V9Type::value_type, float>, float, int32>;
+
+    static LoadedHoleData::HolesType const NoHoles = { };
+    LoadedHoleData::HolesType const& holes = _loadedHoleData ? _loadedHoleData->holes : NoHoles;
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        float cx = MAP_RESOLUTION * (32 - x[i] / SIZE_OF_GRIDS);
+        float cy = MAP_RESOLUTION * (32 - y[i] / SIZE_OF_GRIDS);
+
+        int x_int = (int)cx;
+        int y_int = (int)cy;
+        cx -= x_int;
+        cy -= y_int;
+        x_int &= (MAP_RESOLUTION - 1);
+        y_int &= (MAP_RESOLUTION - 1);
+
+        auto const* v9 = &heightData.v9[x_int * 129 + y_int];
+        HeightType h1 = v9[0];
+        HeightType h2 = v9[129];
+        HeightType h3 = v9[1];
+        HeightType h4 = v9[130];
+        HeightType h5 = 2 * HeightType(heightData.v8[x_int * 128 + y_int]);
+
+        float height = InterpolateCellHeight(cx, cy, h1, h2, h3, h4, h5);
+        if constexpr (!std::is_same_v<HeightType, float>)
+            height = height * heightData.gridIntHeightMultiplier + _loadedHeightData->gridHeight;
+
+        // isHole without branches: each hole is 2x2 squares of an 8x8 cell, one bit per hole in holetab_h & holetab_v
+        uint16 hole = holes[(x_int >> 3) * 16 + (y_int >> 3)];
+        bool isHole = (hole >> (((x_int & 7) >> 1) * 4 + ((y_int & 7) >> 1))) & 1;
+
+        heights[i] = isHole ? INVALID_HEIGHT : height;
+    }
+}
+
 bool GridTerrainData::isHole(int row, int col) const
 {
     if (!_loadedHoleData)
@@ -526,6 +605,45 @@ float GridTerrainData::getLiquidLevel(float x, float y) const
     return _loadedLiquidData->liquidMap->at(cx_int * _loadedLiquidData->liquidWidth + cy_int);
 }
 
+void GridTerrainData::getLiquidLevels(float const* x, float const* y, float* levels, std::size_t count) const
+{
+    if (!_loadedLiquidData || !_loadedLiquidData->liquidMap)
+    {
+        std::fill_n(levels, count, _loadedLiquidData ? _loadedLiquidData->liquidLevel : INVALID_HEIGHT);
+        return;
+    }
+
+    LoadedLiquidData::LiquidMapType const& liquidMap = *_loadedLiquidData->liquidMap;
+    int const offX = _loadedLiquidData->liquidOffX;
+    int const offY = _loadedLiquidData->liquidOffY;
+    int const width = _loadedLiquidData->liquidWidth;
+    int const height = _loadedLiquidData->liquidHeight;
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        int cx_int = ((int)(MAP_RESOLUTION * (32 - x[i] / SIZE_OF_GRIDS)) & (MAP_RESOLUTION - 1)) - offY;
+        int cy_int = ((int)(MAP_RESOLUTION * (32 - y[i] / SIZE_OF_GRIDS)) & (MAP_RESOLUTION - 1)) - offX;
+
+        if (cx_int < 0 || cx_int >= height || cy_int < 0 || cy_int >= width)
+            levels[i] = INVALID_HEIGHT;
+        else
+            levels[i] = liquidMap[cx_int * width + cy_int];
+    }
+}
+
+void GridTerrainData::GetLiquidData(float const* x, float const* y, float const* z, float collisionHeight, Optional<uint8> ReqLiquidType, LiquidData* liquidData, std::size_t count) const
+{
+    // most grids have no liquid at all
+    if (!_loadedLiquidData)
+    {
+        std::fill_n(liquidData, count, LiquidData());
+        return;
+    }
+
+    for (std::size_t i = 0; i < count; ++i)
+        liquidData[i] = GetLiquidData(x[i], y[i], z[i], collisionHeight, ReqLiquidType);
+}
+
 // Get water state on map
 LiquidData const GridTerrainData::GetLiquidData(float x, float y, float z, float collisionHeight, Optional<uint8> ReqLiquidType) const
 {
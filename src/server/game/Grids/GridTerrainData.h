@@ -19,6 +19,8 @@
 #define GRID_TERRAIN_DATA_H
 
 #include "Common.h"
+#include "Optional.h"
+#include <array>
 #include <fstream>
 #include <G3D/Plane.h>
 #include <memory>
@@ -239,6 +241,8 @@ class GridTerrainData
     float getHeightFromUint16(float x, float y) const;
     float getHeightFromUint8(float x, float y) const;
     float getHeightFromFlat(float x, float y) const;
+    template<class HeightData>
+    void getHeightsFromGrid(HeightData const& heightData, float const* x, float const* y, float* heights, std::size_t count) const;
 
 public:
     GridTerrainData();
@@ -247,9 +251,13 @@ public:
 
     uint16 getArea(float x, float y) const;
     inline float getHeight(float x, float y) const { return (this->*_gridGetHeight)(x, y); }
+    // same results as getHeight/getLiquidLevel for every point, for many points of this grid at once
+    void getHeights(float const* x, float const* y, float* heights, std::size_t count) const;
     float getMinHeight(float x, float y) const;
     float getLiquidLevel(float x, float y) const;
+    void getLiquidLevels(float const* x, float const* y, float* levels, std::size_t count) const;
     LiquidData const GetLiquidData(float x, float y, float z, float collisionHeight, Optional<uint8> ReqLiquidType) const;
+    void GetLiquidData(float const* x, float const* y, float const* z, float collisionHeight, Optional<uint8> ReqLiquidType, LiquidData* liquidData, std::size_t count) const;
 };
 
 #endif
@@ -34,6 +34,7 @@
 #include "RBAC.h"
 #include "ScriptMgr.h"
 #include "SocialMgr.h"
+#include "WhoListCacheMgr.h"
 #include "World.h"
 #include "WorldSession.h"
 #include <boost/iterator/counting_iterator.hpp>
@@ -1205,6 +1206,11 @@ bool Guild::SetName(std::string_view const& name)
     stmt->SetData(0, m_name);
     stmt->SetData(1, GetId());
     CharacterDatabase.Execute(stmt);
+
+    for (auto const& [guid, member] : m_members)
+        if (Player* player = member.FindPlayer())
+            sWhoListCacheMgr->MarkDirty(player->GetGUID());
+
     return true;
 }
 
@@ -44,6 +44,7 @@
 #include "Pet.h"
 #include "Player.h"
 #include "PlayerDump.h"
+#include "PlayerLoginCache.h"
 #include "QueryHolder.h"
 #include "RaceMgr.h"
 #include "Realm.h"
@@ -57,6 +58,7 @@
 #include "Tokenize.h"
 #include "Transport.h"
 #include "Util.h"
+#include "WhoListCacheMgr.h"
 #include "World.h"
 #include "WorldPacket.h"
 #include "WorldSession.h"
@@ -782,17 +784,33 @@ void WorldSession::HandlePlayerLoginOpcode(WorldPacket& recvData)
         }
     }
 
-    std::shared_ptr<LoginQueryHolder> holder = std::make_shared<LoginQueryHolder>(GetAccountId(), playerGuid);
-    if (!holder->Initialize())
-        return;
+    std::optional<SQLQueryHolderCallback> cached;
+    if (sPlayerLoginCache->IsEnabled())
+        cached = sPlayerLoginCache->Take(playerGuid, GetAccountId());
+
+    if (!cached)
+    {
+        cached = LoadLoginQueryHolder(GetAccountId(), playerGuid);
+        if (!cached->m_holder)
+            return;
+    }
 
     m_playerLoading = true;
-    AddQueryHolderCallback(CharacterDatabase.DelayQueryHolder(holder)).AfterComplete([this](SQLQueryHolderBase const& holder)
+    AddQueryHolderCallback(std::move(*cached)).AfterComplete([this](SQLQueryHolderBase const& holder)
     {
         HandlePlayerLoginFromDB(static_cast<LoginQueryHolder const&>(holder));
     });
 }
 
+SQLQueryHolderCallback WorldSession::LoadLoginQueryHolder(uint32 accountId, ObjectGuid guid)
+{
+    std::shared_ptr<LoginQueryHolder> holder = std::make_shared<LoginQueryHolder>(accountId, guid);
+    if (!holder->Initialize())
+        return { nullptr, QueryResultHolderFuture() };
+
+    return CharacterDatabase.DelayQueryHolder(holder);
+}
+
 void WorldSession::HandlePlayerLoginFromDB(LoginQueryHolder const& holder)
 {
     ObjectGuid playerGuid = holder.GetGuid();
@@ -1064,6 +1082,7 @@ void WorldSession::HandlePlayerLoginFromDB(LoginQueryHolder const& holder)
         pCurrChar->SetStandState(UNIT_STAND_STATE_STAND);
 
     m_playerLoading = false;
+    sWhoListCacheMgr->MarkDirty(pCurrChar->GetGUID());
 
     // Handle Login-Achievements (should be handled after loading)
     _player->UpdateAchievementCriteria(ACHIEVEMENT_CRITERIA_TYPE_ON_LOGIN, 1);
@@ -1270,6 +1289,7 @@ void WorldSession::HandlePlayerLoginToCharInWorld(Player* pCurrChar)
         ChatHandler(pCurrChar->GetSession()).SendNotification(LANG_GM_ON);
 
     m_playerLoading = false;
+    sWhoListCacheMgr->MarkDirty(pCurrChar->GetGUID());
 }
 
 void WorldSession::HandlePlayerLoginToCharOutOfWorld(Player* /*pCurrChar*/)
@@ -2347,6 +2367,9 @@ void WorldSession::HandleCharFactionOrRaceChangeCallback(std::shared_ptr<Charact
                 stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CHAR_SOCIAL_BY_FRIEND);
                 stmt->SetData(0, lowGuid);
                 trans->Append(stmt);
+
+                // the character is also removed from the friend lists of everyone who had it
+                sPlayerLoginCache->InvalidateAll();
             }
 
             // Leave Arena Teams
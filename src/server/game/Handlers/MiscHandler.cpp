@@ -285,79 +285,61 @@ void WorldSession::HandleWhoOpcode(WorldPacket& recvData)
 
     uint32 team = _player->GetTeamId();
     uint32 gmLevelInWhoList = sWorld->getIntConfig(CONFIG_GM_LEVEL_IN_WHO_LIST);
+    bool seeOtherTeam = HasPermission(rbac::RBAC_PERM_TWO_SIDE_WHO_LIST);
+    bool seeAllSecLevels = HasPermission(rbac::RBAC_PERM_WHO_SEE_ALL_SEC_LEVELS);
     uint32 displaycount = 0;
 
     WorldPacket data(SMSG_WHO, 50);     // guess size
     data << uint32(matchCount);         // placeholder, count of players matching criteria
     data << uint32(displaycount);       // placeholder, count of players displayed
 
-    for (auto const& target : sWhoListCacheMgr->GetWhoList())
+    // level range and zones are looked up in the who list index
+    std::vector<uint32> zones(zoneids.begin(), zoneids.begin() + zonesCount);
+    sWhoListCacheMgr->VisitPlayers(levelMin, levelMax, std::move(zones), [&](WhoListPlayerInfo const& target)
     {
-        if (target.GetTeamId() != team && !HasPermission(rbac::RBAC_PERM_TWO_SIDE_WHO_LIST))
-            continue;
+        if (target.GetTeamId() != team && !seeOtherTeam)
+            return;
 
         // player can see MODERATOR, GAME MASTER, ADMINISTRATOR only if CONFIG_GM_IN_WHO_LIST
-        if (!HasPermission(rbac::RBAC_PERM_WHO_SEE_ALL_SEC_LEVELS) && target.GetSecurity() > AccountTypes(gmLevelInWhoList))
-            continue;
+        if (!seeAllSecLevels && target.GetSecurity() > AccountTypes(gmLevelInWhoList))
+            return;
 
         // check if target is globally visible for player
         if ((_player->GetGUID() != target.GetGuid() && !target.IsVisible()) &&
             (AccountMgr::IsPlayerAccount(_player->GetSession()->GetSecurity()) || target.GetSecurity() > _player->GetSession()->GetSecurity()))
         {
-            continue;
+            return;
         }
 
-        // check if target's level is in level range
         uint8 lvl = target.GetLevel();
-        if (lvl < levelMin || lvl > levelMax)
-        {
-            continue;
-        }
 
         // check if class matches classmask
         uint8 class_ = target.GetClass();
         if (!(classmask & (1 << class_)))
         {
-            continue;
+            return;
         }
 
         // check if race matches racemask
         uint32 race = target.GetRace();
         if (!(racemask & (1 << race)))
         {
-            continue;
+            return;
         }
 
         uint32 playerZoneId = target.GetZoneId();
         uint8 gender = target.GetGender();
 
-        bool showZones = true;
-        for (uint32 i = 0; i < zonesCount; ++i)
-        {
-            if (zoneids[i] == playerZoneId)
-            {
-                showZones = true;
-                break;
-            }
-
-            showZones = false;
-        }
-
-        if (!showZones)
-        {
-            continue;
-        }
-
         std::wstring const& wideplayername = target.GetWidePlayerName();
         if (!(wpacketPlayerName.empty() || wideplayername.find(wpacketPlayerName) != std::wstring::npos))
         {
-            continue;
+            return;
         }
 
         std::wstring const& wideguildname = target.GetWideGuildName();
         if (!(wpacketGuildName.empty() || wideguildname.find(wpacketGuildName) != std::wstring::npos))
         {
-            continue;
+            return;
         }
 
         std::string aname;
@@ -385,14 +367,14 @@ void WorldSession::HandleWhoOpcode(WorldPacket& recvData)
 
         if (!s_show)
         {
-            continue;
+            return;
         }
 
         // 49 is maximum player count sent to client - can be overridden
         // through config, but is unstable
         if ((matchCount++) >= sWorld->getIntConfig(CONFIG_MAX_WHO_LIST_RETURN))
         {
-            continue;
+            return;
         }
 
         data << target.GetPlayerName();                   // player name
@@ -404,7 +386,7 @@ void WorldSession::HandleWhoOpcode(WorldPacket& recvData)
         data << uint32(playerZoneId);                     // player zone id
 
         ++displaycount;
-    }
+    });
 
     data.put(0, displaycount);                            // insert right count, count displayed
     data.put(4, matchCount);                              // insert right count, count of matches
@@ -45,10 +45,34 @@
 void WorldSession::HandleMoveWorldportAckOpcode(WorldPacket& /*recvData*/)
 {
     LOG_DEBUG("network", "WORLD: got MSG_MOVE_WORLDPORT_ACK.");
+
+    // the pending fetch belongs to the player that started it, a character logged in meanwhile is not held back by it
+    if (m_instanceLoadPendingGuid == GetPlayer()->GetGUID() || !GetPlayer()->IsBeingTeleportedFar())
+        return;
+
+    // an instance that is not loaded yet is created once its saved state arrives from the async pool,
+    // instead of the map creation querying it while holding the instanced map lock
+    if (std::shared_ptr<InstanceMapLoadQueryHolder> holder = sMapMgr->PrepareInstanceLoad(GetPlayer()->GetTeleportDest().GetMapId(), GetPlayer()))
+    {
+        m_instanceLoadPendingGuid = GetPlayer()->GetGUID();
+        AddQueryHolderCallback(CharacterDatabase.DelayQueryHolder(holder)).AfterComplete([this, guid = GetPlayer()->GetGUID()](SQLQueryHolderBase const& holder)
+        {
+            if (m_instanceLoadPendingGuid == guid)
+                m_instanceLoadPendingGuid.Clear();
+
+            // the transfer may have been finished by a logout in the meantime
+            if (!_player || _player->GetGUID() != guid)
+                return;
+
+            HandleMoveWorldportAck(static_cast<InstanceMapLoadQueryHolder const*>(&holder));
+        });
+        return;
+    }
+
     HandleMoveWorldportAck();
 }
 
-void WorldSession::HandleMoveWorldportAck()
+void WorldSession::HandleMoveWorldportAck(InstanceMapLoadQueryHolder const* prefetched /*= nullptr*/)
 {
     // ignore unexpected far teleports
     if (!GetPlayer()->IsBeingTeleportedFar())
@@ -87,7 +111,7 @@ void WorldSession::HandleMoveWorldportAck()
     }
 
     // relocate the player to the teleport destination
-    Map* newMap = sMapMgr->CreateMap(loc.GetMapId(), GetPlayer());
+    Map* newMap = sMapMgr->CreateMap(loc.GetMapId(), GetPlayer(), prefetched);
     // the CanEnter checks are done in TeleporTo but conditions may change
     // while the player is in transit, for example the map may get full
     if (!newMap || newMap->CannotEnter(GetPlayer(), false))
@@ -798,12 +798,16 @@ void InstanceScript::SendEncounterUnit(uint32 type, Unit* unit /*= nullptr*/, ui
 
 void InstanceScript::LoadInstanceSavedGameobjectStateData()
 {
-    _objectStateMap.clear();
-
     CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_SELECT_INSTANCE_SAVED_DATA);
     stmt->SetData(0, instance->GetInstanceId());
+    LoadInstanceSavedGameobjectStateData(CharacterDatabase.Query(stmt));
+}
+
+void InstanceScript::LoadInstanceSavedGameobjectStateData(PreparedQueryResult result)
+{
+    _objectStateMap.clear();
 
-    if (PreparedQueryResult result = CharacterDatabase.Query(stmt))
+    if (result)
     {
         Field* fields;
 
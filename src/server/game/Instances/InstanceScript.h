@@ -293,6 +293,7 @@ public:
     [[nodiscard]] uint8 GetStoredGameObjectState(ObjectGuid::LowType spawnId) const;
 
     void LoadInstanceSavedGameobjectStateData();
+    void LoadInstanceSavedGameobjectStateData(PreparedQueryResult result);
 
     [[nodiscard]] bool IsBossDone(uint32 bossId) const { return GetBossState(bossId) == DONE; };
     [[nodiscard]] bool AllBossesDone() const;
@@ -153,21 +153,36 @@ uint32 LootStore::LoadLootTable()
     if (!result)
         return 0;
 
+    struct LootRow
+    {
+        uint32 Entry;
+        uint32 Item;
+        int32 Reference;
+        float Chance;
+        bool QuestRequired;
+        uint16 LootMode;
+        uint8 GroupId;
+        uint8 MinCount;
+        uint8 MaxCount;
+    };
+
+    // decoded column by column, loot tables are among the largest tables loaded at startup
+    std::vector<LootRow> rows = result->FetchRows(&LootRow::Entry, &LootRow::Item, &LootRow::Reference, &LootRow::Chance,
+        &LootRow::QuestRequired, &LootRow::LootMode, &LootRow::GroupId, &LootRow::MinCount, &LootRow::MaxCount);
+
     uint32 count = 0;
 
-    do
+    for (LootRow const& row : rows)
     {
-        Field* fields = result->Fetch();
-
-        uint32 entry               = fields[0].Get<uint32>();
-        uint32 item                = fields[1].Get<uint32>();
-        int32  reference           = fields[2].Get<int32>();
-        float  chance              = fields[3].Get<float>();
-        bool   needsquest          = fields[4].Get<bool>();
-        uint16 lootmode            = fields[5].Get<uint16>();
-        uint8  groupid             = fields[6].Get<uint8>();
-        int32  mincount            = fields[7].Get<uint8>();
-        int32  maxcount            = fields[8].Get<uint8>();
+        uint32 entry               = row.Entry;
+        uint32 item                = row.Item;
+        int32  reference           = row.Reference;
+        float  chance              = row.Chance;
+        bool   needsquest          = row.QuestRequired;
+        uint16 lootmode            = row.LootMode;
+        uint8  groupid             = row.GroupId;
+        int32  mincount            = row.MinCount;
+        int32  maxcount            = row.MaxCount;
 
         if (maxcount > std::numeric_limits<uint8>::max())
         {
@@ -208,7 +223,7 @@ uint32 LootStore::LoadLootTable()
         // Adds current row to the template
         tab->second->AddEntry(storeitem);
         ++count;
-    } while (result->NextRow());
+    }
 
     Verify();                                           // Checks validity of the loot store
 
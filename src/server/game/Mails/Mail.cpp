@@ -26,6 +26,7 @@
 #include "Log.h"
 #include "ObjectMgr.h"
 #include "Player.h"
+#include "PlayerLoginCache.h"
 #include "ScriptMgr.h"
 #include "World.h"
 
@@ -196,6 +197,8 @@ void MailDraft::SendMailTo(CharacterDatabaseTransaction trans, MailReceiver cons
 
     if (pReceiver)
         prepareItems(pReceiver, trans);                            // generate mail template items
+    else
+        sPlayerLoginCache->Invalidate(ObjectGuid::Create<HighGuid::Player>(receiver.GetPlayerGUIDLow()));
 
     uint32 mailId = sObjectMgr->GenerateMailID();
 
@@ -0,0 +1,67 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "BattlegroundMapPool.h"
+
+BattlegroundMap* BattlegroundMapPool::Take(uint8 spawnMode)
+{
+    std::vector<BattlegroundMap*>& maps = _maps[spawnMode];
+    if (maps.empty())
+        return nullptr;
+
+    BattlegroundMap* map = maps.back();
+    maps.pop_back();
+    return map;
+}
+
+void BattlegroundMapPool::Add(uint8 spawnMode, BattlegroundMap* map)
+{
+    _maps[spawnMode].push_back(map);
+}
+
+Optional<uint8> BattlegroundMapPool::GetSpawnModeToFill(std::size_t poolSize) const
+{
+    // the emptiest pool first, so a mode that was just drained is not starved by the others
+    Optional<uint8> spawnMode;
+    std::size_t smallest = poolSize;
+    for (auto const& [mode, maps] : _maps)
+    {
+        if (maps.size() < smallest)
+        {
+            spawnMode = mode;
+            smallest = maps.size();
+        }
+    }
+
+    return spawnMode;
+}
+
+std::size_t BattlegroundMapPool::GetSize(uint8 spawnMode) const
+{
+    auto itr = _maps.find(spawnMode);
+    return itr != _maps.end() ? itr->second.size() : 0;
+}
+
+std::vector<BattlegroundMap*> BattlegroundMapPool::Clear()
+{
+    std::vector<BattlegroundMap*> maps;
+    for (auto& [spawnMode, modeMaps] : _maps)
+        maps.insert(maps.end(), modeMaps.begin(), modeMaps.end());
+
+    _maps.clear();
+    return maps;
+}
@@ -0,0 +1,64 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ACORE_BATTLEGROUND_MAP_POOL_H
+#define ACORE_BATTLEGROUND_MAP_POOL_H
+
+#include "Define.h"
+#include "Optional.h"
+#include <map>
+#include <vector>
+
+class BattlegroundMap;
+
+/**
+ * @brief Battleground maps built in advance, kept apart per spawn mode.
+ *
+ * A spawn mode only gets maps once a battleground asked for it, so brackets with different
+ * PvPDifficulty modes each refill their own pool instead of filling one pool with maps
+ * nobody can take. The pool only stores the maps, building and attaching them is left
+ * to MapInstanced.
+ */
+class BattlegroundMapPool
+{
+public:
+    /// Removes and returns a map of the spawn mode, nullptr if none is ready. Marks the spawn mode as in demand.
+    BattlegroundMap* Take(uint8 spawnMode);
+
+    void Add(uint8 spawnMode, BattlegroundMap* map);
+
+    /// Spawn mode in demand that has fewer than poolSize maps
+    [[nodiscard]] Optional<uint8> GetSpawnModeToFill(std::size_t poolSize) const;
+
+    [[nodiscard]] std::size_t GetSize(uint8 spawnMode) const;
+
+    /// Removes all maps, the caller owns them
+    std::vector<BattlegroundMap*> Clear();
+
+    template<typename Worker>
+    void DoForAllMaps(Worker&& worker) const
+    {
+        for (auto const& [spawnMode, maps] : _maps)
+            for (BattlegroundMap* map : maps)
+                worker(map);
+    }
+
+private:
+    std::map<uint8, std::vector<BattlegroundMap*>> _maps;
+};
+
+#endif
@@ -21,6 +21,7 @@
 #include "Chat.h"
 #include "DisableMgr.h"
 #include "DynamicTree.h"
+#include "GameEventMgr.h"
 #include "GameTime.h"
 #include "Geometry.h"
 #include "GridNotifiers.h"
@@ -30,12 +31,14 @@
 #include "LFGMgr.h"
 #include "MapGrid.h"
 #include "MapInstanced.h"
+#include "MapMgr.h"
 #include "Metric.h"
 #include "MiscPackets.h"
 #include "Object.h"
 #include "ObjectAccessor.h"
 #include "ObjectMgr.h"
 #include "Pet.h"
+#include "PlayerLoginCache.h"
 #include "PoolMgr.h"
 #include "ScriptMgr.h"
 #include "Transport.h"
@@ -217,9 +220,10 @@ void Map::LoadGrid(float x, float y)
 
 void Map::LoadAllGrids()
 {
-    for (uint32 cellX = 0; cellX < TOTAL_NUMBER_OF_CELLS_PER_MAP; cellX++)
-        for (uint32 cellY = 0; cellY < TOTAL_NUMBER_OF_CELLS_PER_MAP; cellY++)
-            LoadGrid((cellX + 0.5f - CENTER_GRID_CELL_ID) * SIZE_OF_GRID_CELL, (cellY + 0.5f - CENTER_GRID_CELL_ID) * SIZE_OF_GRID_CELL);
+    // a grid loads all of its cells, visiting every cell would only repeat the grid lookups (and grid lock) 64 times
+    for (uint32 gridX = 0; gridX < MAX_NUMBER_OF_GRIDS; ++gridX)
+        for (uint32 gridY = 0; gridY < MAX_NUMBER_OF_GRIDS; ++gridY)
+            EnsureGridLoaded(Cell(CellCoord(gridX * MAX_NUMBER_OF_CELLS, gridY * MAX_NUMBER_OF_CELLS)));
 }
 
 void Map::LoadGridsInRange(Position const& center, float radius)
@@ -469,6 +473,16 @@ void Map::Update(const uint32 t_diff, const uint32 s_diff, bool  /*thread*/)
             _respawnCheckTimer -= t_diff;
     }
 
+    if (_respawnSaveTimer <= t_diff)
+    {
+        SaveRespawnTimesToDB();
+        _respawnSaveTimer = sWorld->getIntConfig(CONFIG_RESPAWN_SAVE_INTERVAL);
+    }
+    else
+        _respawnSaveTimer -= t_diff;
+
+    ProcessGameEventTasks();
+
     _updatableObjectListRecheckTimer.Update(t_diff);
     resetMarkedCells();
 
@@ -813,7 +827,7 @@ void Map::PlayerRelocation(Player* player, float x, float y, float z, float o)
     player->UpdateObjectVisibility(false);
 }
 
-void Map::CreatureRelocation(Creature* creature, float x, float y, float z, float o)
+void Map::CreatureRelocation(Creature* creature, float x, float y, float z, float o, bool updatePositionData)
 {
     Cell old_cell = creature->GetCurrentCell();
     Cell new_cell(x, y);
@@ -831,7 +845,10 @@ void Map::CreatureRelocation(Creature* creature, float x, float y, float z, floa
     creature->Relocate(x, y, z, o);
     if (creature->IsVehicle())
         creature->GetVehicleKit()->RelocatePassengers();
-    creature->UpdatePositionData();
+    if (updatePositionData)
+        creature->UpdatePositionData();
+    else
+        creature->SetPositionDataUpdate();
     creature->UpdateObjectVisibility(false);
 }
 
@@ -1080,6 +1097,9 @@ void Map::UnloadAll()
     _corpsesByGrid.clear();
     _corpsesByPlayer.clear();
     _corpseBones.clear();
+
+    // after the grids, unloading them saves the respawn times when SaveRespawnTimeImmediately is off
+    SaveRespawnTimesToDB();
 }
 
 std::shared_ptr<GridTerrainData> Map::GetGridTerrainDataSharedPtr(GridCoord const& gridCoord)
@@ -1154,10 +1174,14 @@ Transport* Map::GetTransportForPos(uint32 phase, float x, float y, float z, Worl
 }
 
 float Map::GetHeight(float x, float y, float z, bool checkVMap /*= true*/, float maxSearchDist /*= DEFAULT_HEIGHT_SEARCH*/) const
+{
+    return GetHeightFromGridHeight(GetGridHeight(x, y), x, y, z, checkVMap, maxSearchDist);
+}
+
+float Map::GetHeightFromGridHeight(float gridHeight, float x, float y, float z, bool checkVMap, float maxSearchDist) const
 {
     // find raw .map surface under Z coordinates
     float mapHeight = VMAP_INVALID_HEIGHT_VALUE;
-    float gridHeight = GetGridHeight(x, y);
     if (G3D::fuzzyGe(z, gridHeight - GROUND_HEIGHT_TOLERANCE))
         mapHeight = gridHeight;
 
@@ -1195,6 +1219,45 @@ float Map::GetGridHeight(float x, float y) const
     return INVALID_HEIGHT;
 }
 
+// calls sample(gridTerrainData, first, count) for each run of consecutive points in the same grid, gridTerrainData may be nullptr
+template<class Sampler>
+void Map::ForEachGridRun(float const* x, float const* y, std::size_t count, Sampler&& sample) const
+{
+    for (std::size_t first = 0; first < count;)
+    {
+        GridCoord const gridCoord = Acore::ComputeGridCoord(x[first], y[first]);
+
+        std::size_t last = first + 1;
+        while (last < count && Acore::ComputeGridCoord(x[last], y[last]) == gridCoord)
+            ++last;
+
+        sample(const_cast<Map*>(this)->GetGridTerrainData(gridCoord), first, last - first);
+        first = last;
+    }
+}
+
+void Map::GetGridHeights(float const* x, float const* y, float* heights, std::size_t count) const
+{
+    ForEachGridRun(x, y, count, [&](GridTerrainData* gmap, std::size_t first, std::size_t runCount)
+    {
+        if (gmap)
+            gmap->getHeights(x + first, y + first, heights + first, runCount);
+        else
+            std::fill_n(heights + first, runCount, INVALID_HEIGHT);
+    });
+}
+
+void Map::GetGridLiquidData(float const* x, float const* y, float const* z, float collisionHeight, Optional<uint8> reqLiquidType, LiquidData* liquidData, std::size_t count) const
+{
+    ForEachGridRun(x, y, count, [&](GridTerrainData* gmap, std::size_t first, std::size_t runCount)
+    {
+        if (gmap)
+            gmap->GetLiquidData(x + first, y + first, z + first, collisionHeight, reqLiquidType, liquidData + first, runCount);
+        else
+            std::fill_n(liquidData + first, runCount, LiquidData());
+    });
+}
+
 float Map::GetMinHeight(float x, float y) const
 {
     if (GridTerrainData const* grid = const_cast<Map*>(this)->GetGridTerrainData(x, y))
@@ -1301,7 +1364,7 @@ void Map::GetZoneAndAreaId(uint32 phaseMask, uint32& zoneid, uint32& areaid, flo
             zoneid = area->zone;
 }
 
-LiquidData const Map::GetLiquidData(uint32 phaseMask, float x, float y, float z, float collisionHeight, Optional<uint8> ReqLiquidType)
+LiquidData const Map::GetLiquidData(uint32 phaseMask, float x, float y, float z, float collisionHeight, Optional<uint8> ReqLiquidType, LiquidData const* gridLiquidData /*= nullptr*/)
 {
    LiquidData liquidData;
    liquidData.Status = LIQUID_MAP_NO_WATER;
@@ -1364,9 +1427,10 @@ LiquidData const Map::GetLiquidData(uint32 phaseMask, float x, float y, float z,
 
     if (useGridLiquid)
     {
-        if (GridTerrainData* gmap = const_cast<Map*>(this)->GetGridTerrainData(x, y))
+        GridTerrainData* gmap = gridLiquidData ? nullptr : const_cast<Map*>(this)->GetGridTerrainData(x, y);
+        if (gridLiquidData || gmap)
         {
-            LiquidData const& map_data = gmap->GetLiquidData(x, y, z, collisionHeight, ReqLiquidType);
+            LiquidData const& map_data = gridLiquidData ? *gridLiquidData : gmap->GetLiquidData(x, y, z, collisionHeight, ReqLiquidType);
             // Not override LIQUID_MAP_ABOVE_WATER with LIQUID_MAP_NO_WATER:
             if (map_data.Status != LIQUID_MAP_NO_WATER && (map_data.Level > vmapData.floorZ))
             {
@@ -1582,6 +1646,18 @@ float Map::GetHeight(uint32 phasemask, float x, float y, float z, bool vmap/*=tr
     return std::max<float>(h1, h2);
 }
 
+void Map::GetHeights(uint32 phasemask, float const* x, float const* y, float const* z, float* heights, std::size_t count, bool vmap /*= true*/, float maxSearchDist /*= DEFAULT_HEIGHT_SEARCH*/) const
+{
+    GetGridHeights(x, y, heights, count);
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        float h1 = GetHeightFromGridHeight(heights[i], x[i], y[i], z[i], vmap, maxSearchDist);
+        float h2 = _mapCollisionData.GetDynamicTree().getHeight(x[i], y[i], z[i], maxSearchDist, phasemask);
+        heights[i] = std::max<float>(h1, h2);
+    }
+}
+
 bool Map::IsInWater(uint32 phaseMask, float x, float y, float pZ, float collisionHeight) const
 {
     LiquidData const& liquidData = const_cast<Map*>(this)->GetLiquidData(phaseMask, x, y, pZ, collisionHeight, {});
@@ -1697,25 +1773,63 @@ void Map::SendRemoveTransports(Player* player)
     player->SendDirectMessage(&packet);
 }
 
+void Map::AddUpdateObject(Object* obj)
+{
+    // Object::m_objectUpdated guarantees a single call until the object is built or removed
+    obj->SetUpdateQueueSlot(_updateObjects.size());
+    _updateObjects.push_back(obj);
+}
+
+void Map::RemoveUpdateObject(Object* obj)
+{
+    // the slot may be stale or from another map (items of a player that changed map), only clear it if it holds the object
+    std::size_t slot = obj->GetUpdateQueueSlot();
+    if (slot < _updateObjects.size() && _updateObjects[slot] == obj)
+        _updateObjects[slot] = nullptr;
+}
+
 void Map::SendObjectUpdates()
 {
-    UpdateDataMapType update_players;
+    if (_updateObjects.empty())
+        return;
 
-    while (!_updateObjects.empty())
+    // built in guid order, every player receives its blocks in the same order however the objects are chunked
+    _updateObjectsBuildList.swap(_updateObjects);
+    _updateObjects.clear();
+    _updateObjectsBuildList.erase(std::remove(_updateObjectsBuildList.begin(), _updateObjectsBuildList.end(), nullptr), _updateObjectsBuildList.end());
+    std::sort(_updateObjectsBuildList.begin(), _updateObjectsBuildList.end(), [](Object const* left, Object const* right)
     {
-        Object* obj = *_updateObjects.begin();
-        ASSERT(obj->IsInWorld());
+        return left->GetGUID() < right->GetGUID();
+    });
 
-        _updateObjects.erase(_updateObjects.begin());
-        obj->BuildUpdate(update_players);
-    }
+    ObjectUpdateBuilder& builder = sMapMgr->GetObjectUpdateBuilder();
+    std::size_t chunkCount = builder.GetChunkCount(_updateObjectsBuildList.size());
+    if (_updatePlayersStaging.size() < chunkCount)
+        _updatePlayersStaging.resize(chunkCount);
+
+    // BuildUpdate runs on the builder threads: objects only clear their own changes (ClearUpdateMask(false)),
+    // nothing may touch _updateObjects until Build returns
+    builder.Build(_updateObjectsBuildList, _updatePlayersStaging.data(), chunkCount);
+    ObjectUpdateBuilder::Merge(_updatePlayersStaging.data(), chunkCount);
+    _updateObjectsBuildList.clear();
+
+    UpdateDataMapType& update_players = _updatePlayersStaging[0];
 
     WorldPacket packet;                                     // here we allocate a std::vector with a size of 0x10000
-    for (UpdateDataMapType::iterator iter = update_players.begin(); iter != update_players.end(); ++iter)
+    for (UpdateDataMapType::iterator iter = update_players.begin(); iter != update_players.end();)
     {
+        // players that got nothing since the last call may have left the map, drop them
+        if (!iter->second.HasData())
+        {
+            iter = update_players.erase(iter);
+            continue;
+        }
+
         iter->second.BuildPacket(packet);
         iter->first->SendDirectMessage(&packet);
         packet.clear();                                     // clean the string
+        iter->second.Clear();                               // keep the buffer for the next update
+        ++iter;
     }
 }
 
@@ -2102,7 +2216,7 @@ void InstanceMap::AfterPlayerUnlinkFromMap()
     Map::AfterPlayerUnlinkFromMap();
 }
 
-void InstanceMap::CreateInstanceScript(bool load, std::string data, uint32 completedEncounterMask)
+void InstanceMap::CreateInstanceScript(bool load, std::string data, uint32 completedEncounterMask, InstanceMapLoadQueryHolder const* prefetched /*= nullptr*/)
 {
     if (instance_data)
     {
@@ -2144,7 +2258,10 @@ void InstanceMap::CreateInstanceScript(bool load, std::string data, uint32 compl
             instance_data->Load(data.c_str());
     }
 
-    instance_data->LoadInstanceSavedGameobjectStateData();
+    if (prefetched)
+        instance_data->LoadInstanceSavedGameobjectStateData(prefetched->GetPreparedResult(InstanceMapLoadQueryHolder::GAMEOBJECT_STATES));
+    else
+        instance_data->LoadInstanceSavedGameobjectStateData();
 }
 
 /*
@@ -2407,6 +2524,8 @@ void Map::SaveCreatureRespawnTime(ObjectGuid::LowType spawnId, time_t& respawnTi
     if (GetInstanceResetPeriod() > 0 && respawnTime - now + 5 >= GetInstanceResetPeriod())
         respawnTime = now + YEAR;
 
+    QueueRespawnTimeSave(_creatureRespawnSaves, _creatureRespawnTimes, spawnId, respawnTime);
+
     // Remove old queue entry if updating an existing respawn time
     auto itr = _creatureRespawnTimes.find(spawnId);
     if (itr != _creatureRespawnTimes.end())
@@ -2414,29 +2533,18 @@ void Map::SaveCreatureRespawnTime(ObjectGuid::LowType spawnId, time_t& respawnTi
 
     _creatureRespawnTimes[spawnId] = respawnTime;
     _respawnQueue.insert({respawnTime, SPAWN_TYPE_CREATURE, spawnId});
-
-    CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_REP_CREATURE_RESPAWN);
-    stmt->SetData(0, spawnId);
-    stmt->SetData(1, uint32(respawnTime));
-    stmt->SetData(2, GetId());
-    stmt->SetData(3, GetInstanceId());
-    CharacterDatabase.Execute(stmt);
 }
 
 void Map::RemoveCreatureRespawnTime(ObjectGuid::LowType spawnId)
 {
+    QueueRespawnTimeSave(_creatureRespawnSaves, _creatureRespawnTimes, spawnId, 0);
+
     auto itr = _creatureRespawnTimes.find(spawnId);
     if (itr != _creatureRespawnTimes.end())
     {
         _respawnQueue.erase({itr->second, SPAWN_TYPE_CREATURE, spawnId});
         _creatureRespawnTimes.erase(itr);
     }
-
-    CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CREATURE_RESPAWN);
-    stmt->SetData(0, spawnId);
-    stmt->SetData(1, GetId());
-    stmt->SetData(2, GetInstanceId());
-    CharacterDatabase.Execute(stmt);
 }
 
 void Map::SaveGORespawnTime(ObjectGuid::LowType spawnId, time_t& respawnTime)
@@ -2452,6 +2560,8 @@ void Map::SaveGORespawnTime(ObjectGuid::LowType spawnId, time_t& respawnTime)
     if (GetInstanceResetPeriod() > 0 && respawnTime - now + 5 >= GetInstanceResetPeriod())
         respawnTime = now + YEAR;
 
+    QueueRespawnTimeSave(_goRespawnSaves, _goRespawnTimes, spawnId, respawnTime);
+
     // Remove old queue entry if updating an existing respawn time
     auto itr = _goRespawnTimes.find(spawnId);
     if (itr != _goRespawnTimes.end())
@@ -2459,29 +2569,62 @@ void Map::SaveGORespawnTime(ObjectGuid::LowType spawnId, time_t& respawnTime)
 
     _goRespawnTimes[spawnId] = respawnTime;
     _respawnQueue.insert({respawnTime, SPAWN_TYPE_GAMEOBJECT, spawnId});
-
-    CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_REP_GO_RESPAWN);
-    stmt->SetData(0, spawnId);
-    stmt->SetData(1, uint32(respawnTime));
-    stmt->SetData(2, GetId());
-    stmt->SetData(3, GetInstanceId());
-    CharacterDatabase.Execute(stmt);
 }
 
 void Map::RemoveGORespawnTime(ObjectGuid::LowType spawnId)
 {
+    QueueRespawnTimeSave(_goRespawnSaves, _goRespawnTimes, spawnId, 0);
+
     auto itr = _goRespawnTimes.find(spawnId);
     if (itr != _goRespawnTimes.end())
     {
         _respawnQueue.erase({itr->second, SPAWN_TYPE_GAMEOBJECT, spawnId});
         _goRespawnTimes.erase(itr);
     }
+}
 
-    CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_GO_RESPAWN);
-    stmt->SetData(0, spawnId);
-    stmt->SetData(1, GetId());
-    stmt->SetData(2, GetInstanceId());
-    CharacterDatabase.Execute(stmt);
+void Map::QueueRespawnTimeSave(RespawnTimeSaveQueue& queue, std::unordered_map<ObjectGuid::LowType, time_t> const& respawnTimes,
+    ObjectGuid::LowType spawnId, time_t respawnTime)
+{
+    // the respawn times in memory are what the database holds, apart from the pending changes
+    queue.Queue(spawnId, respawnTime, respawnTimes.contains(spawnId));
+
+    if (!sWorld->getIntConfig(CONFIG_RESPAWN_SAVE_INTERVAL))
+        SaveRespawnTimesToDB();
+}
+
+void Map::SaveRespawnTimesToDB()
+{
+    if (_creatureRespawnSaves.Empty() && _goRespawnSaves.Empty())
+        return;
+
+    CharacterDatabaseTransaction trans = CharacterDatabase.BeginTransaction();
+
+    for (auto [queue, replaceStatement, deleteStatement] : { std::tuple{ &_creatureRespawnSaves, CHAR_REP_CREATURE_RESPAWN, CHAR_DEL_CREATURE_RESPAWN },
+        std::tuple{ &_goRespawnSaves, CHAR_REP_GO_RESPAWN, CHAR_DEL_GO_RESPAWN } })
+    {
+        queue->Flush([&](ObjectGuid::LowType spawnId, time_t respawnTime)
+        {
+            CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(replaceStatement);
+            stmt->SetData(0, spawnId);
+            stmt->SetData(1, uint32(respawnTime));
+            stmt->SetData(2, GetId());
+            stmt->SetData(3, GetInstanceId());
+            trans->Append(stmt);
+        },
+        [&](ObjectGuid::LowType spawnId)
+        {
+            CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(deleteStatement);
+            stmt->SetData(0, spawnId);
+            stmt->SetData(1, GetId());
+            stmt->SetData(2, GetInstanceId());
+            trans->Append(stmt);
+        });
+    }
+
+    // all changes may have cancelled each other out
+    if (trans->GetSize())
+        CharacterDatabase.CommitTransaction(trans);
 }
 
 void Map::LoadRespawnTimes()
@@ -2489,7 +2632,17 @@ void Map::LoadRespawnTimes()
     CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_CREATURE_RESPAWNS);
     stmt->SetData(0, GetId());
     stmt->SetData(1, GetInstanceId());
-    if (PreparedQueryResult result = CharacterDatabase.Query(stmt))
+    PreparedQueryResult creatureResult = CharacterDatabase.Query(stmt);
+
+    stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_GO_RESPAWNS);
+    stmt->SetData(0, GetId());
+    stmt->SetData(1, GetInstanceId());
+    LoadRespawnTimes(creatureResult, CharacterDatabase.Query(stmt));
+}
+
+void Map::LoadRespawnTimes(PreparedQueryResult creatureResult, PreparedQueryResult gameObjectResult)
+{
+    if (PreparedQueryResult result = creatureResult)
     {
         do
         {
@@ -2502,10 +2655,7 @@ void Map::LoadRespawnTimes()
         } while (result->NextRow());
     }
 
-    stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_GO_RESPAWNS);
-    stmt->SetData(0, GetId());
-    stmt->SetData(1, GetInstanceId());
-    if (PreparedQueryResult result = CharacterDatabase.Query(stmt))
+    if (PreparedQueryResult result = gameObjectResult)
     {
         do
         {
@@ -2525,6 +2675,10 @@ void Map::DeleteRespawnTimes()
     _goRespawnTimes.clear();
     _respawnQueue.clear();
 
+    // changes not written yet must not bring rows back after the delete
+    _creatureRespawnSaves.Clear();
+    _goRespawnSaves.Clear();
+
     DeleteRespawnTimesInDB(GetId(), GetInstanceId());
 }
 
@@ -2854,6 +3008,125 @@ void Map::ProcessGameObjectRespawn(ObjectGuid::LowType spawnId)
         delete gameobject;
 }
 
+void Map::AddGameEventTask(GameEventTaskType type, ObjectGuid::LowType spawnId)
+{
+    std::lock_guard<std::mutex> guard(_gameEventTasksLock);
+    _gameEventTasks.push_back({ type, spawnId });
+}
+
+void Map::ProcessGameEventTasks()
+{
+    std::vector<GameEventTask> tasks;
+    std::size_t pending;
+    {
+        std::lock_guard<std::mutex> guard(_gameEventTasksLock);
+        if (_gameEventTasks.empty())
+            return;
+
+        std::size_t count = _gameEventTasks.size();
+        if (uint32 budget = sWorld->getIntConfig(CONFIG_EVENT_MAP_TASKS_PER_UPDATE))
+            count = std::min<std::size_t>(count, budget);
+
+        tasks.assign(_gameEventTasks.begin(), _gameEventTasks.begin() + count);
+        _gameEventTasks.erase(_gameEventTasks.begin(), _gameEventTasks.begin() + count);
+        pending = _gameEventTasks.size();
+    }
+
+    // objects despawned earlier in this batch are still in the spawn id stores
+    auto isSpawned = [this](auto const& bounds)
+    {
+        for (auto itr = bounds.first; itr != bounds.second; ++itr)
+            if (!i_objectsToRemove.count(itr->second))
+                return true;
+        return false;
+    };
+
+    for (GameEventTask const& task : tasks)
+    {
+        switch (task.Type)
+        {
+            case GameEventTaskType::SpawnCreature:
+            {
+                CreatureData const* data = sObjectMgr->GetCreatureData(task.SpawnId);
+                // grids loaded later spawn it themselves, skip it if the event was stopped again meanwhile
+                if (!data || !IsGridLoaded(data->posX, data->posY) || isSpawned(_creatureBySpawnIdStore.equal_range(task.SpawnId)))
+                    break;
+
+                if (!sObjectMgr->GetGridObjectGuids(GetId(), GetSpawnMode(), Acore::ComputeGridCoord(data->posX, data->posY).GetId()).creatures.count(task.SpawnId))
+                    break;
+
+                Creature* creature = new Creature();
+                if (!creature->LoadCreatureFromDB(task.SpawnId, this))
+                    delete creature;
+                break;
+            }
+            case GameEventTaskType::SpawnGameObject:
+            {
+                GameObjectData const* data = sObjectMgr->GetGameObjectData(task.SpawnId);
+                if (!data || !IsGridLoaded(data->posX, data->posY) || isSpawned(_gameobjectBySpawnIdStore.equal_range(task.SpawnId)))
+                    break;
+
+                if (!sObjectMgr->GetGridObjectGuids(GetId(), GetSpawnMode(), Acore::ComputeGridCoord(data->posX, data->posY).GetId()).gameobjects.count(task.SpawnId))
+                    break;
+
+                GameObject* gameobject = sObjectMgr->IsGameObjectStaticTransport(data->id) ? new StaticTransport() : new GameObject();
+                if (!gameobject->LoadGameObjectFromDB(task.SpawnId, this, false))
+                    delete gameobject;
+                else if (gameobject->isSpawnedByDefault())
+                    AddToMap(gameobject);
+                break;
+            }
+            case GameEventTaskType::DespawnCreature:
+            {
+                auto bounds = _creatureBySpawnIdStore.equal_range(task.SpawnId);
+                for (auto itr = bounds.first; itr != bounds.second;)
+                {
+                    Creature* creature = itr->second;
+                    ++itr;
+                    creature->AddObjectToRemoveList();
+                }
+                break;
+            }
+            case GameEventTaskType::DespawnGameObject:
+            {
+                auto bounds = _gameobjectBySpawnIdStore.equal_range(task.SpawnId);
+                for (auto itr = bounds.first; itr != bounds.second;)
+                {
+                    GameObject* gameobject = itr->second;
+                    ++itr;
+                    gameobject->AddObjectToRemoveList();
+                }
+                break;
+            }
+            case GameEventTaskType::UpdateNpcFlags:
+            {
+                auto bounds = _creatureBySpawnIdStore.equal_range(task.SpawnId);
+                for (auto itr = bounds.first; itr != bounds.second; ++itr)
+                {
+                    Creature* creature = itr->second;
+                    uint32 npcflag = sGameEventMgr->GetNPCFlag(creature);
+                    if (CreatureTemplate const* creatureTemplate = creature->GetCreatureTemplate())
+                        npcflag |= creatureTemplate->npcflag;
+
+                    creature->ReplaceAllNpcFlags(NPCFlags(npcflag));
+                }
+                break;
+            }
+        }
+    }
+
+    METRIC_VALUE("map_game_event_tasks", uint64(tasks.size()),
+        METRIC_TAG("map_id", std::to_string(GetId())),
+        METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+
+    METRIC_VALUE("map_game_event_tasks_pending", uint64(pending),
+        METRIC_TAG("map_id", std::to_string(GetId())),
+        METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+
+    if (!pending)
+        LOG_DEBUG("gameevent", "Map {} (instance {}) applied all queued game event changes.", GetId(), GetInstanceId());
+}
+
 void Map::UpdateEncounterState(EncounterCreditType type, uint32 creditEntry, Unit* source)
 {
     Difficulty difficulty_fixed = (IsSharedDifficultyMap(GetId()) ? Difficulty(GetDifficulty() % 2) : GetDifficulty());
@@ -3445,10 +3718,13 @@ void Map::LoadCorpseData()
     CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_CORPSES);
     stmt->SetData(0, GetId());
     stmt->SetData(1, GetInstanceId());
+    LoadCorpseData(CharacterDatabase.Query(stmt));
+}
 
+void Map::LoadCorpseData(PreparedQueryResult result)
+{
     //        0     1     2     3            4      5          6          7       8       9        10     11        12    13          14          15         16
     // SELECT posX, posY, posZ, orientation, mapId, displayId, itemCache, bytes1, bytes2, guildId, flags, dynFlags, time, corpseType, instanceId, phaseMask, guid FROM corpse WHERE mapId = ? AND instanceId = ?
-    PreparedQueryResult result = CharacterDatabase.Query(stmt);
     if (!result)
         return;
 
@@ -3484,6 +3760,10 @@ void Map::DeleteCorpseData()
     stmt->SetData(0, GetId());
     stmt->SetData(1, GetInstanceId());
     CharacterDatabase.Execute(stmt);
+
+    // every corpse of the instance was loaded with the map, their owners are likely offline
+    for (auto const& [ownerGuid, corpse] : _corpsesByPlayer)
+        sPlayerLoginCache->Invalidate(ownerGuid);
 }
 
 std::string Map::GetDebugInfo() const
@@ -21,6 +21,7 @@
 #include "Cell.h"
 #include "DBCStructure.h"
 #include "DataMap.h"
+#include "DatabaseEnvFwd.h"
 #include "Define.h"
 #include "DynamicTree.h"
 #include "EventProcessor.h"
@@ -34,15 +35,20 @@
 #include "ObjectGuid.h"
 #include "PathGenerator.h"
 #include "Position.h"
+#include "RespawnTimeSaveQueue.h"
 #include "SharedDefines.h"
 #include "SpawnData.h"
 #include "Timer.h"
+#include "UpdateData.h"
 #include "GridTerrainData.h"
 #include <bitset>
+#include <deque>
 #include <list>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <shared_mutex>
+#include <unordered_map>
 
 class Unit;
 class WorldPacket;
@@ -61,6 +67,7 @@ struct Position;
 class Battleground;
 class MapInstanced;
 class InstanceMap;
+class InstanceMapLoadQueryHolder;
 class BattlegroundMap;
 class Transport;
 class StaticTransport;
@@ -202,7 +209,8 @@ public:
     virtual void InitVisibilityDistance();
 
     void PlayerRelocation(Player*, float x, float y, float z, float o);
-    void CreatureRelocation(Creature* creature, float x, float y, float z, float o);
+    // transport passengers pass updatePositionData = false, their terrain data is only computed when queried
+    void CreatureRelocation(Creature* creature, float x, float y, float z, float o, bool updatePositionData = true);
     void GameObjectRelocation(GameObject* go, float x, float y, float z, float o);
     void DynamicObjectRelocation(DynamicObject* go, float x, float y, float z, float o);
 
@@ -242,11 +250,14 @@ public:
     [[nodiscard]] float GetHeight(float x, float y, float z, bool checkVMap = true, float maxSearchDist = DEFAULT_HEIGHT_SEARCH) const;
     [[nodiscard]] float GetHeight(Position const& pos, bool checkVMap = true, float maxSearchDist = DEFAULT_HEIGHT_SEARCH) const { return GetHeight(pos.GetPositionX(), pos.GetPositionY(), pos.GetPositionZ(), checkVMap, maxSearchDist); }
     [[nodiscard]] float GetGridHeight(float x, float y) const;
+    void GetGridHeights(float const* x, float const* y, float* heights, std::size_t count) const;
+    void GetGridLiquidData(float const* x, float const* y, float const* z, float collisionHeight, Optional<uint8> reqLiquidType, LiquidData* liquidData, std::size_t count) const;
     [[nodiscard]] float GetMinHeight(float x, float y) const;
     Transport* GetTransportForPos(uint32 phase, float x, float y, float z, WorldObject* worldobject = nullptr);
 
     void GetFullTerrainStatusForPosition(uint32 phaseMask, float x, float y, float z, float collisionHeight, PositionFullTerrainStatus& data, Optional<uint8> reqLiquidType = {});
-    LiquidData const GetLiquidData(uint32 phaseMask, float x, float y, float z, float collisionHeight, Optional<uint8> ReqLiquidType);
+    // gridLiquidData: liquid of the grid at the point when it was sampled in advance with GetGridLiquidData
+    LiquidData const GetLiquidData(uint32 phaseMask, float x, float y, float z, float collisionHeight, Optional<uint8> ReqLiquidType, LiquidData const* gridLiquidData = nullptr);
 
     [[nodiscard]] bool GetAreaInfo(uint32 phaseMask, float x, float y, float z, uint32& mogpflags, int32& adtId, int32& rootId, int32& groupId) const;
     [[nodiscard]] uint32 GetAreaId(uint32 phaseMask, float x, float y, float z) const;
@@ -386,6 +397,8 @@ public:
 
     float GetWaterOrGroundLevel(uint32 phasemask, float x, float y, float z, float* ground = nullptr, bool swim = false, float collisionHeight = DEFAULT_COLLISION_HEIGHT) const;
     [[nodiscard]] float GetHeight(uint32 phasemask, float x, float y, float z, bool vmap = true, float maxSearchDist = DEFAULT_HEIGHT_SEARCH) const;
+    // same as GetHeight for every point, the grid heights of consecutive points in the same grid are sampled together
+    void GetHeights(uint32 phasemask, float const* x, float const* y, float const* z, float* heights, std::size_t count, bool vmap = true, float maxSearchDist = DEFAULT_HEIGHT_SEARCH) const;
     [[nodiscard]] bool isInLineOfSight(float x1, float y1, float z1, float x2, float y2, float z2, uint32 phasemask, LineOfSightChecks checks, VMAP::ModelIgnoreFlags ignoreFlags) const;
     bool CanReachPositionAndGetValidCoords(WorldObject const* source, PathGenerator *path, float &destX, float &destY, float &destZ, bool failOnCollision = true, bool failOnSlopes = true) const;
     bool CanReachPositionAndGetValidCoords(WorldObject const* source, float &destX, float &destY, float &destZ, bool failOnCollision = true, bool failOnSlopes = true) const;
@@ -429,6 +442,7 @@ public:
     [[nodiscard]] std::unordered_map<ObjectGuid::LowType, time_t> const& GetCreatureRespawnTimes() const { return _creatureRespawnTimes; }
     [[nodiscard]] std::unordered_map<ObjectGuid::LowType, time_t> const& GetGORespawnTimes() const { return _goRespawnTimes; }
     void LoadRespawnTimes();
+    void LoadRespawnTimes(PreparedQueryResult creatureResult, PreparedQueryResult gameObjectResult);
     void DeleteRespawnTimes();
     [[nodiscard]] time_t GetInstanceResetPeriod() const { return _instanceResetPeriod; }
 
@@ -442,6 +456,19 @@ public:
     void ProcessCreatureRespawn(ObjectGuid::LowType spawnId);
     void ProcessGameObjectRespawn(ObjectGuid::LowType spawnId);
 
+    enum class GameEventTaskType : uint8
+    {
+        SpawnCreature,
+        SpawnGameObject,
+        DespawnCreature,
+        DespawnGameObject,
+        UpdateNpcFlags
+    };
+
+    // Spawn changes of starting and stopping game events, applied in Map::Update within Event.MapTasksPerUpdate
+    void AddGameEventTask(GameEventTaskType type, ObjectGuid::LowType spawnId);
+    void ProcessGameEventTasks();
+
     [[nodiscard]] time_t GetRespawnTime(SpawnObjectType type, ObjectGuid::LowType spawnId) const
     {
         switch (type)
@@ -474,6 +501,7 @@ public:
     void ScheduleCreatureRespawn(ObjectGuid /*creatureGuid*/, Milliseconds /*respawnTimer*/, Position pos = Position());
 
     void LoadCorpseData();
+    void LoadCorpseData(PreparedQueryResult result);
     void DeleteCorpseData();
     void AddCorpse(Corpse* corpse);
     void RemoveCorpse(Corpse* corpse);
@@ -522,15 +550,8 @@ public:
         return GetGuidSequenceGenerator<high>().Generate();
     }
 
-    void AddUpdateObject(Object* obj)
-    {
-        _updateObjects.insert(obj);
-    }
-
-    void RemoveUpdateObject(Object* obj)
-    {
-        _updateObjects.erase(obj);
-    }
+    void AddUpdateObject(Object* obj);
+    void RemoveUpdateObject(Object* obj);
 
     size_t GetUpdatableObjectsCount() const { return _updatableObjectList.size(); }
 
@@ -566,6 +587,12 @@ public:
 
 private:
 
+    // GetHeight with the grid height at the point already sampled
+    [[nodiscard]] float GetHeightFromGridHeight(float gridHeight, float x, float y, float z, bool checkVMap, float maxSearchDist) const;
+
+    template<class Sampler>
+    void ForEachGridRun(float const* x, float const* y, std::size_t count, Sampler&& sample) const;
+
     template<class T> void InitializeObject(T* obj);
     void AddCreatureToMoveList(Creature* c);
     void RemoveCreatureFromMoveList(Creature* c);
@@ -640,6 +667,15 @@ private:
     std::unordered_map<ObjectGuid::LowType /*dbGUID*/, time_t> _creatureRespawnTimes;
     std::unordered_map<ObjectGuid::LowType /*dbGUID*/, time_t> _goRespawnTimes;
 
+    void QueueRespawnTimeSave(RespawnTimeSaveQueue& queue, std::unordered_map<ObjectGuid::LowType, time_t> const& respawnTimes,
+        ObjectGuid::LowType spawnId, time_t respawnTime);
+    void SaveRespawnTimesToDB();
+
+    // Respawn time changes not written yet (see CONFIG_RESPAWN_SAVE_INTERVAL)
+    RespawnTimeSaveQueue _creatureRespawnSaves;
+    RespawnTimeSaveQueue _goRespawnSaves;
+    uint32 _respawnSaveTimer{0};
+
     // Time-ordered index for ProcessRespawns() — avoids O(n) full scan.
     // Based on TrinityCore's priority queue approach (r00ty-tc, 59db2eee).
     struct RespawnEntry
@@ -658,6 +694,14 @@ private:
     };
     std::set<RespawnEntry> _respawnQueue;
 
+    struct GameEventTask
+    {
+        GameEventTaskType Type;
+        ObjectGuid::LowType SpawnId;
+    };
+    std::deque<GameEventTask> _gameEventTasks;
+    std::mutex _gameEventTasksLock;
+
     std::unordered_set<uint32> _toggledSpawnGroupIds;
     uint32 _respawnCheckTimer{0};
 
@@ -687,7 +731,9 @@ private:
     std::unordered_map<ObjectGuid, Corpse*> _corpsesByPlayer;
     std::unordered_set<Corpse*> _corpseBones;
 
-    std::unordered_set<Object*> _updateObjects;
+    std::vector<Object*> _updateObjects;                    // append only, removed objects leave a nullptr until the next SendObjectUpdates
+    std::vector<Object*> _updateObjectsBuildList;
+    std::vector<std::unordered_map<Player*, UpdateData>> _updatePlayersStaging; // one per build chunk, kept between updates
 
     UpdatableObjectList _updatableObjectList;
     PendingAddUpdatableObjectList _pendingAddUpdatableObjectList;
@@ -713,7 +759,7 @@ public:
     void RemovePlayerFromMap(Player*, bool) override;
     void AfterPlayerUnlinkFromMap() override;
     void Update(const uint32, const uint32, bool thread = true) override;
-    void CreateInstanceScript(bool load, std::string data, uint32 completedEncounterMask);
+    void CreateInstanceScript(bool load, std::string data, uint32 completedEncounterMask, InstanceMapLoadQueryHolder const* prefetched = nullptr);
     bool Reset(uint8 method, GuidList* globalSkipList = nullptr);
     [[nodiscard]] uint32 GetScriptId() const { return i_script_id; }
     [[nodiscard]] std::string const& GetScriptName() const;
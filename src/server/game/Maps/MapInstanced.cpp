@@ -24,6 +24,31 @@
 #include "Player.h"
 #include "ScriptMgr.h"
 
+InstanceMapLoadQueryHolder::InstanceMapLoadQueryHolder(uint32 mapId, uint32 instanceId)
+    : _mapId(mapId), _instanceId(instanceId)
+{
+    SetSize(MAX);
+
+    CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_CREATURE_RESPAWNS);
+    stmt->SetData(0, mapId);
+    stmt->SetData(1, instanceId);
+    SetPreparedQuery(CREATURE_RESPAWNS, stmt);
+
+    stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_GO_RESPAWNS);
+    stmt->SetData(0, mapId);
+    stmt->SetData(1, instanceId);
+    SetPreparedQuery(GAMEOBJECT_RESPAWNS, stmt);
+
+    stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_CORPSES);
+    stmt->SetData(0, mapId);
+    stmt->SetData(1, instanceId);
+    SetPreparedQuery(CORPSES, stmt);
+
+    stmt = CharacterDatabase.GetPreparedStatement(CHAR_SELECT_INSTANCE_SAVED_DATA);
+    stmt->SetData(0, instanceId);
+    SetPreparedQuery(GAMEOBJECT_STATES, stmt);
+}
+
 MapInstanced::MapInstanced(uint32 id) : Map(id, 0, DUNGEON_DIFFICULTY_NORMAL)
 {
     // initialize instanced maps list
@@ -39,6 +64,8 @@ void MapInstanced::InitVisibilityDistance()
     {
         (*i).second->InitVisibilityDistance();
     }
+
+    _battlegroundMapPool.DoForAllMaps([](BattlegroundMap* map) { map->InitVisibilityDistance(); });
 }
 
 void MapInstanced::Update(const uint32 t, const uint32 s_diff, bool /*thread*/)
@@ -98,6 +125,12 @@ void MapInstanced::UnloadAll()
 
     m_InstancedMaps.clear();
 
+    for (BattlegroundMap* map : _battlegroundMapPool.Clear())
+    {
+        map->UnloadAll();
+        delete map;
+    }
+
     // Unload own grids (just dummy(placeholder) grids, neccesary to unload GridMaps!)
     Map::UnloadAll();
 }
@@ -106,8 +139,9 @@ void MapInstanced::UnloadAll()
 - return the right instance for the object, based on its InstanceId
 - create the instance if it's not created already
 - the player is not actually added to the instance (only in InstanceMap::Add)
+- prefetched is the instance's saved state from PrepareInstanceLoadForPlayer, it is only used for the instance it was fetched for
 */
-Map* MapInstanced::CreateInstanceForPlayer(const uint32 mapId, Player* player)
+Map* MapInstanced::CreateInstanceForPlayer(const uint32 mapId, Player* player, InstanceMapLoadQueryHolder const* prefetched /*= nullptr*/)
 {
     if (GetId() != mapId || !player)
         return nullptr;
@@ -147,7 +181,7 @@ Map* MapInstanced::CreateInstanceForPlayer(const uint32 mapId, Player* player)
 
             map = FindInstanceMap(destInstId);
             if (!map)
-                map = CreateInstance(destInstId, pSave, realdiff, player);
+                map = CreateInstance(destInstId, pSave, realdiff, player, prefetched);
             else if (IsSharedDifficultyMap(mapId) && !map->HavePlayers() && map->GetDifficulty() != realdiff)
             {
                 if (player->isBeingLoaded()) // pussywizard: crashfix (assert(passengers.empty) fail in ~transport), could be added to a transport during loading from db
@@ -177,7 +211,24 @@ Map* MapInstanced::CreateInstanceForPlayer(const uint32 mapId, Player* player)
     return map;
 }
 
-InstanceMap* MapInstanced::CreateInstance(uint32 InstanceId, InstanceSave* save, Difficulty difficulty, Player* player)
+/*
+- returns the queries for the saved state of the instance the player is going to be put in by CreateInstanceForPlayer,
+  or nullptr when that instance is already loaded (or not a dungeon instance)
+- a brand new instance has no saved state to fetch, it keeps the synchronous path and gets its id in CreateInstanceForPlayer
+*/
+std::shared_ptr<InstanceMapLoadQueryHolder> MapInstanced::PrepareInstanceLoadForPlayer(Player* player)
+{
+    if (!player || IsBattlegroundOrArena())
+        return nullptr;
+
+    uint32 destInstId = sInstanceSaveMgr->PlayerGetDestinationInstanceId(player, GetId(), player->GetDifficulty(IsRaid()));
+    if (!destInstId || FindInstanceMap(destInstId))
+        return nullptr;
+
+    return std::make_shared<InstanceMapLoadQueryHolder>(GetId(), destInstId);
+}
+
+InstanceMap* MapInstanced::CreateInstance(uint32 InstanceId, InstanceSave* save, Difficulty difficulty, Player* player, InstanceMapLoadQueryHolder const* prefetched /*= nullptr*/)
 {
     // load/create a map
     std::lock_guard<std::mutex> guard(Lock);
@@ -205,13 +256,26 @@ InstanceMap* MapInstanced::CreateInstance(uint32 InstanceId, InstanceSave* save,
     ASSERT(map->IsDungeon());
     m_InstancedMaps[InstanceId] = map;
 
-    map->LoadRespawnTimes();
-    map->LoadCorpseData();
+    // saved state fetched through the async pool before the map was created, the lock is not held for database round trips
+    if (prefetched && (prefetched->GetMapId() != GetId() || prefetched->GetInstanceId() != InstanceId))
+        prefetched = nullptr;
+
+    if (prefetched)
+    {
+        map->LoadRespawnTimes(prefetched->GetPreparedResult(InstanceMapLoadQueryHolder::CREATURE_RESPAWNS),
+            prefetched->GetPreparedResult(InstanceMapLoadQueryHolder::GAMEOBJECT_RESPAWNS));
+        map->LoadCorpseData(prefetched->GetPreparedResult(InstanceMapLoadQueryHolder::CORPSES));
+    }
+    else
+    {
+        map->LoadRespawnTimes();
+        map->LoadCorpseData();
+    }
 
     if (save)
-        map->CreateInstanceScript(true, save->GetInstanceData(), save->GetCompletedEncounterMask());
+        map->CreateInstanceScript(true, save->GetInstanceData(), save->GetCompletedEncounterMask(), prefetched);
     else
-        map->CreateInstanceScript(false, "", 0);
+        map->CreateInstanceScript(false, "", 0, prefetched);
 
     if (map->GetInstanceScript() && map->GetInstanceScript()->IsTwoFactionInstance()
         && map->GetInstanceScript()->GetTeamIdInInstance() == TEAM_NEUTRAL)
@@ -231,6 +295,14 @@ InstanceMap* MapInstanced::CreateInstance(uint32 InstanceId, InstanceSave* save,
     return map;
 }
 
+static uint8 GetBattlegroundSpawnMode(Battleground* bg)
+{
+    if (PvPDifficultyEntry const* bracketEntry = GetBattlegroundBracketByLevel(bg->GetMapId(), bg->GetMinLevel()))
+        return bracketEntry->difficulty;
+
+    return REGULAR_DIFFICULTY;
+}
+
 BattlegroundMap* MapInstanced::CreateBattleground(uint32 InstanceId, Battleground* bg)
 {
     // load/create a map
@@ -238,16 +310,7 @@ BattlegroundMap* MapInstanced::CreateBattleground(uint32 InstanceId, Battlegroun
 
     LOG_DEBUG("maps", "MapInstanced::CreateBattleground: map bg {} for {} created.", InstanceId, GetId());
 
-    PvPDifficultyEntry const* bracketEntry = GetBattlegroundBracketByLevel(bg->GetMapId(), bg->GetMinLevel());
-
-    uint8 spawnMode;
-
-    if (bracketEntry)
-        spawnMode = bracketEntry->difficulty;
-    else
-        spawnMode = REGULAR_DIFFICULTY;
-
-    BattlegroundMap* map = new BattlegroundMap(GetId(), InstanceId, this, spawnMode);
+    BattlegroundMap* map = new BattlegroundMap(GetId(), InstanceId, this, GetBattlegroundSpawnMode(bg));
     ASSERT(map->IsBattlegroundOrArena());
     m_InstancedMaps[InstanceId] = map;
 
@@ -259,6 +322,50 @@ BattlegroundMap* MapInstanced::CreateBattleground(uint32 InstanceId, Battlegroun
     return map;
 }
 
+/*
+- returns a pooled map for a new battleground, which has to take over its instance id and be passed to AddBattlegroundMap
+- pooled maps are never used ones: a battleground leaves doors, spawns and scores behind that nothing resets,
+  so the maps of finished battlegrounds are destroyed as before and the pool is refilled with new ones
+*/
+BattlegroundMap* MapInstanced::TakePooledBattlegroundMap(Battleground* bg)
+{
+    return _battlegroundMapPool.Take(GetBattlegroundSpawnMode(bg));
+}
+
+void MapInstanced::AddBattlegroundMap(BattlegroundMap* map, Battleground* bg)
+{
+    std::lock_guard<std::mutex> guard(Lock);
+
+    ASSERT(map->GetInstanceId() == bg->GetInstanceID() && !FindInstanceMap(map->GetInstanceId()));
+    m_InstancedMaps[map->GetInstanceId()] = map;
+
+    map->SetBG(bg);
+    bg->SetBgMap(map);
+
+    // the grids were loaded while pooled, map scripts only see the map once it has its battleground
+    sScriptMgr->OnCreateMap(map);
+
+    LOG_DEBUG("maps", "MapInstanced::AddBattlegroundMap: pooled map bg {} for {} taken.", map->GetInstanceId(), GetId());
+}
+
+/*
+- builds at most one map per world update, on the world thread: instance ids and grid loading are not thread safe
+- only the grids are loaded here (the first half of Map::OnCreateMap), the map has no battleground yet:
+  spawns loaded with the grids must not expect GetBG() to be set, the OnCreateMap script hook runs in AddBattlegroundMap
+*/
+void MapInstanced::FillBattlegroundMapPool()
+{
+    Optional<uint8> spawnMode = _battlegroundMapPool.GetSpawnModeToFill(sWorld->getIntConfig(CONFIG_BATTLEGROUND_MAP_POOL_SIZE));
+    if (!spawnMode)
+        return;
+
+    BattlegroundMap* map = new BattlegroundMap(GetId(), sMapMgr->GenerateInstanceId(), this, *spawnMode);
+    ASSERT(map->IsBattlegroundOrArena() && !map->GetBG());
+    map->LoadAllGrids();
+
+    _battlegroundMapPool.Add(*spawnMode, map);
+}
+
 // increments the iterator after erase
 bool MapInstanced::DestroyInstance(InstancedMaps::iterator& itr)
 {
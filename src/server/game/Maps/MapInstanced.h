@@ -18,9 +18,35 @@
 #ifndef ACORE_MAP_INSTANCED_H
 #define ACORE_MAP_INSTANCED_H
 
+#include "BattlegroundMapPool.h"
 #include "DBCEnums.h"
 #include "InstanceSaveMgr.h"
 #include "Map.h"
+#include "QueryHolder.h"
+
+/// Saved state of an instance map (respawn times, corpses, gameobject states), fetched before the map is created
+class InstanceMapLoadQueryHolder : public CharacterDatabaseQueryHolder
+{
+public:
+    enum
+    {
+        CREATURE_RESPAWNS,
+        GAMEOBJECT_RESPAWNS,
+        CORPSES,
+        GAMEOBJECT_STATES,
+
+        MAX
+    };
+
+    InstanceMapLoadQueryHolder(uint32 mapId, uint32 instanceId);
+
+    [[nodiscard]] uint32 GetMapId() const { return _mapId; }
+    [[nodiscard]] uint32 GetInstanceId() const { return _instanceId; }
+
+private:
+    uint32 _mapId;
+    uint32 _instanceId;
+};
 
 class MapInstanced : public Map
 {
@@ -38,7 +64,8 @@ public:
     void UnloadAll() override;
     EnterState CannotEnter(Player* player, bool loginCheck = false) override;
 
-    Map* CreateInstanceForPlayer(const uint32 mapId, Player* player);
+    Map* CreateInstanceForPlayer(const uint32 mapId, Player* player, InstanceMapLoadQueryHolder const* prefetched = nullptr);
+    std::shared_ptr<InstanceMapLoadQueryHolder> PrepareInstanceLoadForPlayer(Player* player);
     Map* FindInstanceMap(uint32 instanceId) const
     {
         InstancedMaps::const_iterator i = m_InstancedMaps.find(instanceId);
@@ -49,10 +76,17 @@ public:
     InstancedMaps& GetInstancedMaps() { return m_InstancedMaps; }
     void InitVisibilityDistance() override;
 
+    // Battleground maps built in advance (see CONFIG_BATTLEGROUND_MAP_POOL_SIZE)
+    BattlegroundMap* TakePooledBattlegroundMap(Battleground* bg);
+    void AddBattlegroundMap(BattlegroundMap* map, Battleground* bg);
+    void FillBattlegroundMapPool();
+
 private:
-    InstanceMap* CreateInstance(uint32 InstanceId, InstanceSave* save, Difficulty difficulty, Player* player);
+    InstanceMap* CreateInstance(uint32 InstanceId, InstanceSave* save, Difficulty difficulty, Player* player, InstanceMapLoadQueryHolder const* prefetched = nullptr);
     BattlegroundMap* CreateBattleground(uint32 InstanceId, Battleground* bg);
 
     InstancedMaps m_InstancedMaps;
+
+    BattlegroundMapPool _battlegroundMapPool;                        // built and loaded, no instance lookup finds them yet
 };
 #endif
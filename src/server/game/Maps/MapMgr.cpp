@@ -59,6 +59,9 @@ void MapMgr::Initialize()
     // Start mtmaps if needed
     if (num_threads > 0)
         m_updater.activate(num_threads);
+
+    if (uint32 builderThreads = sWorld->getIntConfig(CONFIG_MAP_OBJECT_UPDATE_THREADS))
+        _objectUpdateBuilder.Activate(builderThreads);
 }
 
 void MapMgr::InitializeVisibilityDistanceInfo()
@@ -110,16 +113,25 @@ Map* MapMgr::FindBaseNonInstanceMap(uint32 mapId) const
     return map;
 }
 
-Map* MapMgr::CreateMap(uint32 id, Player* player)
+Map* MapMgr::CreateMap(uint32 id, Player* player, InstanceMapLoadQueryHolder const* prefetched /*= nullptr*/)
 {
     Map* m = CreateBaseMap(id);
 
     if (m && m->Instanceable())
-        m = ((MapInstanced*)m)->CreateInstanceForPlayer(id, player);
+        m = ((MapInstanced*)m)->CreateInstanceForPlayer(id, player, prefetched);
 
     return m;
 }
 
+std::shared_ptr<InstanceMapLoadQueryHolder> MapMgr::PrepareInstanceLoad(uint32 mapId, Player* player)
+{
+    MapEntry const* entry = sMapStore.LookupEntry(mapId);
+    if (!entry || !entry->IsDungeon())
+        return nullptr;
+
+    return ((MapInstanced*)CreateBaseMap(mapId))->PrepareInstanceLoadForPlayer(player);
+}
+
 Map* MapMgr::FindMap(uint32 mapid, uint32 instanceId) const
 {
     Map* map = FindBaseMap(mapid);
@@ -278,6 +290,12 @@ void MapMgr::Update(uint32 diff)
     if (m_updater.activated())
         m_updater.wait();
 
+    // pooled battleground maps are built here and not in MapInstanced::Update, which may run on a map updater thread
+    if (sWorld->getIntConfig(CONFIG_BATTLEGROUND_MAP_POOL_SIZE))
+        for (iter = i_maps.begin(); iter != i_maps.end(); ++iter)
+            if (iter->second->IsBattlegroundOrArena())
+                iter->second->ToMapInstanced()->FillBattlegroundMapPool();
+
     if (mapUpdateStep < 3)
     {
         for (iter = i_maps.begin(); iter != i_maps.end(); ++iter)
@@ -335,6 +353,8 @@ void MapMgr::UnloadAll()
 
     if (m_updater.activated())
         m_updater.deactivate();
+
+    _objectUpdateBuilder.Deactivate();
 }
 
 void MapMgr::GetNumInstances(uint32& dungeons, uint32& battlegrounds, uint32& arenas)
@@ -23,6 +23,7 @@
 #include "Map.h"
 #include "MapInstanced.h"
 #include "MapUpdater.h"
+#include "ObjectUpdateBuilder.h"
 #include "Object.h"
 #include "Timer.h"
 
@@ -38,7 +39,8 @@ public:
 
     Map* CreateBaseMap(uint32 mapId);
     Map* FindBaseNonInstanceMap(uint32 mapId) const;
-    Map* CreateMap(uint32 mapId, Player* player);
+    Map* CreateMap(uint32 mapId, Player* player, InstanceMapLoadQueryHolder const* prefetched = nullptr);
+    std::shared_ptr<InstanceMapLoadQueryHolder> PrepareInstanceLoad(uint32 mapId, Player* player);
     Map* FindMap(uint32 mapId, uint32 instanceId) const;
 
     Map* FindBaseMap(uint32 mapId) const // pussywizard: need this public for movemaps (mmaps)
@@ -151,6 +153,7 @@ public:
     uint32 GenerateInstanceId();
 
     MapUpdater* GetMapUpdater() { return &m_updater; }
+    ObjectUpdateBuilder& GetObjectUpdateBuilder() { return _objectUpdateBuilder; }
 
     template<typename Worker>
     void DoForAllMaps(Worker&& worker);
@@ -176,6 +179,7 @@ private:
     InstanceIds _instanceIds;
     uint32 _nextInstanceId;
     MapUpdater m_updater;
+    ObjectUpdateBuilder _objectUpdateBuilder;
 };
 
 template<typename Worker>
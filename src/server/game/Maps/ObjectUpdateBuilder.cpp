@@ -0,0 +1,148 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ObjectUpdateBuilder.h"
+#include "Errors.h"
+#include <algorithm>
+
+ObjectUpdateBuilder::~ObjectUpdateBuilder()
+{
+    Deactivate();
+}
+
+void ObjectUpdateBuilder::Activate(std::size_t numThreads)
+{
+    _workerThreads.reserve(numThreads);
+    for (std::size_t i = 0; i < numThreads; ++i)
+        _workerThreads.push_back(std::thread(&ObjectUpdateBuilder::WorkerThread, this));
+}
+
+void ObjectUpdateBuilder::Deactivate()
+{
+    if (!IsActive())
+        return;
+
+    // called once the maps stopped updating, no batch is waiting for the queue
+    _cancelationToken = true;
+    _queue.Cancel();
+
+    for (std::thread& thread : _workerThreads)
+        if (thread.joinable())
+            thread.join();
+
+    _workerThreads.clear();
+}
+
+std::size_t ObjectUpdateBuilder::GetChunkCount(std::size_t objectCount) const
+{
+    if (!IsActive())
+        return 1;
+
+    return std::clamp<std::size_t>(objectCount / MinObjectsPerChunk, 1, _workerThreads.size() + 1);
+}
+
+void ObjectUpdateBuilder::Build(std::vector<Object*> const& objects, UpdateDataMapType* staging, std::size_t chunkCount)
+{
+    ASSERT(chunkCount > 0);
+
+    Object* const* first = objects.data();
+    std::size_t const count = objects.size();
+
+    if (chunkCount == 1)
+    {
+        BuildChunk(first, first + count, staging[0]);
+        return;
+    }
+
+    Batch batch;
+    batch.PendingChunks = chunkCount - 1;
+
+    for (std::size_t i = 1; i < chunkCount; ++i)
+    {
+        ChunkTask task;
+        task.Begin = first + i * count / chunkCount;
+        task.End = first + (i + 1) * count / chunkCount;
+        task.Data = &staging[i];
+        task.Owner = &batch;
+        _queue.Push(task);
+    }
+
+    BuildChunk(first, first + count / chunkCount, staging[0]);
+
+    // help with queued chunks, they may belong to another map waiting the same way
+    ChunkTask task;
+    while (batch.PendingChunks.load(std::memory_order_acquire) && _queue.Pop(task))
+        RunTask(task);
+
+    std::unique_lock<std::mutex> lock(batch.Lock);
+    batch.Finished.wait(lock, [&batch] { return batch.PendingChunks.load(std::memory_order_acquire) == 0; });
+}
+
+void ObjectUpdateBuilder::Merge(UpdateDataMapType* staging, std::size_t chunkCount)
+{
+    UpdateDataMapType& merged = staging[0];
+
+    for (std::size_t i = 1; i < chunkCount; ++i)
+    {
+        for (UpdateDataMapType::iterator itr = staging[i].begin(); itr != staging[i].end();)
+        {
+            // entries are kept while the player receives updates, so their buffers are reused
+            if (!itr->second.HasData())
+            {
+                itr = staging[i].erase(itr);
+                continue;
+            }
+
+            merged[itr->first].AddUpdateBlock(itr->second);
+            itr->second.Clear();
+            ++itr;
+        }
+    }
+}
+
+void ObjectUpdateBuilder::BuildChunk(Object* const* begin, Object* const* end, UpdateDataMapType& data)
+{
+    for (; begin != end; ++begin)
+    {
+        Object* obj = *begin;
+        ASSERT(obj->IsInWorld());
+        obj->BuildUpdate(data);
+    }
+}
+
+void ObjectUpdateBuilder::RunTask(ChunkTask const& task)
+{
+    BuildChunk(task.Begin, task.End, *task.Data);
+
+    // decremented under the lock, the waiting thread destroys the batch as soon as it sees 0
+    std::lock_guard<std::mutex> lock(task.Owner->Lock);
+    if (task.Owner->PendingChunks.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        task.Owner->Finished.notify_all();
+}
+
+void ObjectUpdateBuilder::WorkerThread()
+{
+    while (!_cancelationToken)
+    {
+        ChunkTask task;
+
+        _queue.WaitAndPop(task);
+
+        if (!_cancelationToken && task.Owner)
+            RunTask(task);
+    }
+}
@@ -0,0 +1,89 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _OBJECT_UPDATE_BUILDER_H
+#define _OBJECT_UPDATE_BUILDER_H
+
+#include "Define.h"
+#include "Object.h"
+#include "PCQueue.h"
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/*
+ * Builds the update blocks of a map's changed objects in chunks.
+ *
+ * The objects are split into contiguous chunks, each one is built into its own
+ * staging map, so the workers never share an UpdateData. Merge() then appends
+ * the chunks of every player in chunk order: a player receives the blocks in
+ * the order of the object list, whatever the number of chunks.
+ *
+ * Building an update only reads the object and its viewers, so the chunks of a
+ * map can be built while that map's thread waits for them. The map thread
+ * builds the first chunk itself and helps with queued chunks while waiting.
+ */
+class ObjectUpdateBuilder
+{
+public:
+    // below this many objects per chunk the hand-off costs more than it saves
+    static constexpr std::size_t MinObjectsPerChunk = 64;
+
+    ObjectUpdateBuilder() = default;
+    ~ObjectUpdateBuilder();
+
+    void Activate(std::size_t numThreads);
+    void Deactivate();
+    [[nodiscard]] bool IsActive() const { return !_workerThreads.empty(); }
+
+    // number of staging maps Build() uses for that many objects, 1 builds everything on the calling thread
+    [[nodiscard]] std::size_t GetChunkCount(std::size_t objectCount) const;
+
+    // builds objects into staging[0, chunkCount), staging entries are appended to, not cleared
+    void Build(std::vector<Object*> const& objects, UpdateDataMapType* staging, std::size_t chunkCount);
+
+    // appends staging[1, chunkCount) to staging[0] and clears them, dropping players without data
+    static void Merge(UpdateDataMapType* staging, std::size_t chunkCount);
+
+private:
+    struct Batch
+    {
+        std::atomic<std::size_t> PendingChunks{ 0 };
+        std::mutex Lock;
+        std::condition_variable Finished;
+    };
+
+    struct ChunkTask
+    {
+        Object* const* Begin = nullptr;
+        Object* const* End = nullptr;
+        UpdateDataMapType* Data = nullptr;
+        Batch* Owner = nullptr;
+    };
+
+    static void BuildChunk(Object* const* begin, Object* const* end, UpdateDataMapType& data);
+    static void RunTask(ChunkTask const& task);
+    void WorkerThread();
+
+    ProducerConsumerQueue<ChunkTask> _queue;
+    std::atomic<bool> _cancelationToken{ false };
+    std::vector<std::thread> _workerThreads;
+};
+
+#endif
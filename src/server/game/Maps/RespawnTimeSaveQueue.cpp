@@ -0,0 +1,25 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "RespawnTimeSaveQueue.h"
+
+void RespawnTimeSaveQueue::Queue(ObjectGuid::LowType spawnId, time_t respawnTime, bool inDatabase)
+{
+    auto [itr, inserted] = _saves.try_emplace(spawnId, PendingSave{ respawnTime, inDatabase });
+    if (!inserted)
+        itr->second.RespawnTime = respawnTime;
+}
@@ -0,0 +1,68 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ACORE_RESPAWN_TIME_SAVE_QUEUE_H
+#define ACORE_RESPAWN_TIME_SAVE_QUEUE_H
+
+#include "ObjectGuid.h"
+#include <ctime>
+#include <unordered_map>
+
+/**
+ * @brief Respawn time changes of one spawn type of a map that are not written to the database yet.
+ *
+ * The latest change of a spawn wins and a delete replaces a pending insert. A delete of a row
+ * that never reached the database is dropped, whether the row exists is only looked at for the
+ * first pending change of a spawn. Writing the changes is left to Map.
+ */
+class RespawnTimeSaveQueue
+{
+public:
+    /// A respawnTime of 0 deletes the row, inDatabase tells whether the row exists before this change
+    void Queue(ObjectGuid::LowType spawnId, time_t respawnTime, bool inDatabase);
+
+    /// Drops all pending changes
+    void Clear() { _saves.clear(); }
+
+    [[nodiscard]] bool Empty() const { return _saves.empty(); }
+
+    /// Hands every change still to be written to replace(spawnId, respawnTime) or remove(spawnId), then drops them
+    template<typename Replace, typename Remove>
+    void Flush(Replace&& replace, Remove&& remove)
+    {
+        for (auto const& [spawnId, save] : _saves)
+        {
+            if (save.RespawnTime)
+                replace(spawnId, save.RespawnTime);
+            else if (save.InDatabase)                       // a row inserted and deleted again before being written needs nothing
+                remove(spawnId);
+        }
+
+        _saves.clear();
+    }
+
+private:
+    struct PendingSave
+    {
+        time_t RespawnTime;                                 // 0 deletes the row
+        bool InDatabase;                                    // the row existed before the first pending change
+    };
+
+    std::unordered_map<ObjectGuid::LowType /*dbGUID*/, PendingSave> _saves;
+};
+
+#endif
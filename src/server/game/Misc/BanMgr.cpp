@@ -23,6 +23,7 @@
 #include "Language.h"
 #include "ObjectAccessor.h"
 #include "Player.h"
+#include "PlayerLoginCache.h"
 #include "ScriptMgr.h"
 #include "World.h"
 #include "WorldSession.h"
@@ -251,6 +252,8 @@ BanReturn BanMgr::BanCharacter(std::string const& CharacterName, std::string con
 
     if (target)
         target->GetSession()->KickPlayer("Ban");
+    else
+        sPlayerLoginCache->Invalidate(TargetGUID);
 
     if (sWorld->getBoolConfig(CONFIG_SHOW_BAN_IN_WORLD))
     {
@@ -20,6 +20,7 @@
 #include "MapMgr.h"
 #include "MoveSplineInit.h"
 #include "Player.h"
+#include <array>
 
 template<class T>
 void ConfusedMovementGenerator<T>::DoInitialize(T* unit)
@@ -30,11 +31,14 @@ void ConfusedMovementGenerator<T>::DoInitialize(T* unit)
     float y = unit->GetPositionY();
     float z = unit->GetPositionZ();
 
-    Map const* map = unit->GetMap();
+    Map* map = unit->GetMap();
 
     bool is_water_ok, is_land_ok;
     _InitSpecific(unit, is_water_ok, is_land_ok);
 
+    // all wander points are picked first, so the terrain under them is sampled in one pass per grid
+    std::array<float, MAX_CONF_WAYPOINTS + 1> wanderXs, wanderYs, searchZs, heights, liquidZs;
+    std::array<LiquidData, MAX_CONF_WAYPOINTS + 1> gridLiquids;
     for (uint8 idx = 0; idx < MAX_CONF_WAYPOINTS + 1; ++idx)
     {
         float wanderX = x + (wander_distance * (float)rand_norm() - wander_distance / 2);
@@ -44,7 +48,21 @@ void ConfusedMovementGenerator<T>::DoInitialize(T* unit)
         Acore::NormalizeMapCoord(wanderX);
         Acore::NormalizeMapCoord(wanderY);
 
-        float new_z = unit->GetMapHeight(wanderX, wanderY, z);
+        wanderXs[idx] = wanderX;
+        wanderYs[idx] = wanderY;
+        searchZs[idx] = z != MAX_HEIGHT ? z + std::max(unit->GetCollisionHeight(), Z_OFFSET_FIND_HEIGHT) : z; // as in WorldObject::GetMapHeight
+        liquidZs[idx] = z;
+    }
+
+    map->GetHeights(unit->GetPhaseMask(), wanderXs.data(), wanderYs.data(), searchZs.data(), heights.data(), heights.size());
+    map->GetGridLiquidData(wanderXs.data(), wanderYs.data(), liquidZs.data(), unit->GetCollisionHeight(), {}, gridLiquids.data(), gridLiquids.size());
+
+    for (uint8 idx = 0; idx < MAX_CONF_WAYPOINTS + 1; ++idx)
+    {
+        float wanderX = wanderXs[idx];
+        float wanderY = wanderYs[idx];
+
+        float new_z = heights[idx];
         if (new_z <= INVALID_HEIGHT || std::fabs(z - new_z) > 3.0f) // pussywizard
         {
             i_waypoints[idx][0] = idx > 0 ? i_waypoints[idx - 1][0] : x;
@@ -54,7 +72,9 @@ void ConfusedMovementGenerator<T>::DoInitialize(T* unit)
         }
         else if (unit->IsWithinLOS(wanderX, wanderY, z))
         {
-            bool is_water = map->IsInWater(unit->GetPhaseMask(), wanderX, wanderY, z, unit->GetCollisionHeight());
+            // same as Map::IsInWater, with the grid liquid sampled above
+            LiquidData const& liquidData = map->GetLiquidData(unit->GetPhaseMask(), wanderX, wanderY, z, unit->GetCollisionHeight(), {}, &gridLiquids[idx]);
+            bool is_water = (liquidData.Status & MAP_LIQUID_STATUS_SWIMMING) != 0;
 
             if ((is_water && !is_water_ok) || (!is_water && !is_land_ok))
             {
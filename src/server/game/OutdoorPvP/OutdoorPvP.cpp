@@ -178,12 +178,8 @@ bool OPvPCapturePoint::DelCreature(uint32 type)
     // so this is a big fat workaround, if AddObjectToRemoveList and DoDelayedMovesAndRemoves worked correctly, this wouldn't be needed
     //if (Map* map = sMapMgr->FindMap(cr->GetMapId()))
     //    map->Remove(cr, false);
-    // delete respawn time for this creature
-    CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CREATURE_RESPAWN);
-    stmt->SetData(0, spawnId);
-    stmt->SetData(1, _pvp->GetMap()->GetId());
-    stmt->SetData(2, 0);  // instance id, always 0 for world maps
-    CharacterDatabase.Execute(stmt);
+    // delete respawn time for this creature, through the map so it cannot overtake a pending save of it
+    _pvp->GetMap()->RemoveCreatureRespawnTime(spawnId);
 
     sObjectMgr->DeleteCreatureData(spawnId);
     _creatureTypes[_creatures[type]] = 0;
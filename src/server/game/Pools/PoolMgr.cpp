@@ -17,11 +17,13 @@
 
 #include "PoolMgr.h"
 #include "Containers.h"
+#include "DBCStores.h"
 #include "Log.h"
 #include "MapMgr.h"
 #include "ObjectMgr.h"
 #include "QueryResult.h"
 #include "Transport.h"
+#include <limits>
 
 ////////////////////////////////////////////////////////////
 // template class ActivePoolData
@@ -133,11 +135,29 @@ template <class T>
 void PoolGroup<T>::AddEntry(PoolObject& poolitem, uint32 maxentries)
 {
     if (poolitem.chance != 0 && maxentries == 1)
+    {
         ExplicitlyChanced.push_back(poolitem);
+        ExplicitlyChancedRoll.push_back((ExplicitlyChancedRoll.empty() ? 0.0f : ExplicitlyChancedRoll.back()) + poolitem.chance);
+    }
     else
         EqualChanced.push_back(poolitem);
 }
 
+// Method to rebuild the running chance sums after the explicitly chanced list changed
+template <class T>
+void PoolGroup<T>::BuildRollTable()
+{
+    ExplicitlyChancedRoll.clear();
+    ExplicitlyChancedRoll.reserve(ExplicitlyChanced.size());
+
+    float chance = 0.0f;
+    for (PoolObject const& obj : ExplicitlyChanced)
+    {
+        chance += obj.chance;
+        ExplicitlyChancedRoll.push_back(chance);
+    }
+}
+
 // Method to check the chances are proper in this object pool
 template <class T>
 bool PoolGroup<T>::CheckPool() const
@@ -300,6 +320,8 @@ void PoolGroup<Pool>::RemoveOneRelation(uint32 child_pool_id)
             break;
         }
     }
+
+    BuildRollTable();
 }
 
 template <class T>
@@ -325,13 +347,15 @@ void PoolGroup<T>::SpawnObject(ActivePoolData& spawns, uint32 limit, uint32 trig
         {
             float roll = (float)rand_chance();
 
-            for (PoolObject& obj : ExplicitlyChanced)
+            // first object whose running chance sum exceeds the roll, or the next one not spawned yet
+            std::size_t i = std::upper_bound(ExplicitlyChancedRoll.begin(), ExplicitlyChancedRoll.end(), roll) - ExplicitlyChancedRoll.begin();
+            for (; i < ExplicitlyChanced.size(); ++i)
             {
-                roll -= obj.chance;
+                PoolObject& obj = ExplicitlyChanced[i];
 
                 // Triggering object is marked as spawned at this time and can be also rolled (respawn case)
                 // so this need explicit check for this case
-                if (roll < 0 && (obj.guid == triggerFrom || !spawns.IsActiveObject<T>(obj.guid)))
+                if (obj.guid == triggerFrom || !spawns.IsActiveObject<T>(obj.guid))
                 {
                     rolledObjects.push_back(obj);
                     break;
@@ -341,12 +365,20 @@ void PoolGroup<T>::SpawnObject(ActivePoolData& spawns, uint32 limit, uint32 trig
 
         if (!EqualChanced.empty() && rolledObjects.empty())
         {
-            std::copy_if(EqualChanced.begin(), EqualChanced.end(), std::back_inserter(rolledObjects), [triggerFrom, &spawns](PoolObject const& object)
+            // pick <count> of the objects not spawned yet in a single pass (reservoir sampling)
+            uint32 candidates = 0;
+            for (PoolObject& obj : EqualChanced)
             {
-                 return object.guid == triggerFrom || !spawns.IsActiveObject<T>(object.guid);
-            });
+                if (obj.guid != triggerFrom && spawns.IsActiveObject<T>(obj.guid))
+                    continue;
 
-            Acore::Containers::RandomResize(rolledObjects, count);
+                if (rolledObjects.size() < std::size_t(count))
+                    rolledObjects.push_back(obj);
+                else if (uint32 slot = urand(0, candidates); slot < uint32(count))
+                    rolledObjects[slot] = obj;
+
+                ++candidates;
+            }
         }
 
         // try to spawn rolled objects
@@ -917,6 +949,8 @@ void PoolMgr::LoadFromDB()
         }
     }
 
+    ShardSpawnedData();
+
     // The initialize method will spawn all pools not in an event and not in another pool, this is why there is 2 left joins with 2 null checks
     LOG_INFO("server.loading", "Starting Objects Pooling System...");
     {
@@ -1060,7 +1094,11 @@ void PoolMgr::SpawnPool<Creature>(uint32 pool_id, uint32 db_guid)
 {
     auto it = mPoolCreatureGroups.find(pool_id);
     if (it != mPoolCreatureGroups.end() && !it->second.IsEmpty())
-        it->second.SpawnObject(mSpawnedData, mPoolTemplate[pool_id].MaxLimit, db_guid);
+    {
+        ActivePoolData& spawns = GetActivePoolData(pool_id);
+        auto guard = LockSpawnedData(spawns);
+        it->second.SpawnObject(spawns, mPoolTemplate[pool_id].MaxLimit, db_guid);
+    }
 }
 
 // Call to spawn a pool, if cache if true the method will spawn only if cached entry is different
@@ -1070,7 +1108,11 @@ void PoolMgr::SpawnPool<GameObject>(uint32 pool_id, uint32 db_guid)
 {
     auto it = mPoolGameobjectGroups.find(pool_id);
     if (it != mPoolGameobjectGroups.end() && !it->second.IsEmpty())
-        it->second.SpawnObject(mSpawnedData, mPoolTemplate[pool_id].MaxLimit, db_guid);
+    {
+        ActivePoolData& spawns = GetActivePoolData(pool_id);
+        auto guard = LockSpawnedData(spawns);
+        it->second.SpawnObject(spawns, mPoolTemplate[pool_id].MaxLimit, db_guid);
+    }
 }
 
 // Call to spawn a pool, if cache if true the method will spawn only if cached entry is different
@@ -1080,7 +1122,11 @@ void PoolMgr::SpawnPool<Pool>(uint32 pool_id, uint32 sub_pool_id)
 {
     auto it = mPoolPoolGroups.find(pool_id);
     if (it != mPoolPoolGroups.end() && !it->second.IsEmpty())
-        it->second.SpawnObject(mSpawnedData, mPoolTemplate[pool_id].MaxLimit, sub_pool_id);
+    {
+        ActivePoolData& spawns = GetActivePoolData(pool_id);
+        auto guard = LockSpawnedData(spawns);
+        it->second.SpawnObject(spawns, mPoolTemplate[pool_id].MaxLimit, sub_pool_id);
+    }
 }
 
 // Call to spawn a pool
@@ -1089,7 +1135,11 @@ void PoolMgr::SpawnPool<Quest>(uint32 pool_id, uint32 quest_id)
 {
     auto it = mPoolQuestGroups.find(pool_id);
     if (it != mPoolQuestGroups.end() && !it->second.IsEmpty())
-        it->second.SpawnObject(mSpawnedData, mPoolTemplate[pool_id].MaxLimit, quest_id);
+    {
+        ActivePoolData& spawns = GetActivePoolData(pool_id);
+        auto guard = LockSpawnedData(spawns);
+        it->second.SpawnObject(spawns, mPoolTemplate[pool_id].MaxLimit, quest_id);
+    }
 }
 
 void PoolMgr::SpawnPool(uint32 pool_id)
@@ -1103,25 +1153,28 @@ void PoolMgr::SpawnPool(uint32 pool_id)
 // Call to despawn a pool, all gameobjects/creatures in this pool are removed
 void PoolMgr::DespawnPool(uint32 pool_id)
 {
+    ActivePoolData& spawns = GetActivePoolData(pool_id);
+    auto guard = LockSpawnedData(spawns);
+
     {
         auto it = mPoolCreatureGroups.find(pool_id);
         if (it != mPoolCreatureGroups.end() && !it->second.IsEmpty())
-            it->second.DespawnObject(mSpawnedData);
+            it->second.DespawnObject(spawns);
     }
     {
         auto it = mPoolGameobjectGroups.find(pool_id);
         if (it != mPoolGameobjectGroups.end() && !it->second.IsEmpty())
-            it->second.DespawnObject(mSpawnedData);
+            it->second.DespawnObject(spawns);
     }
     {
         auto it = mPoolPoolGroups.find(pool_id);
         if (it != mPoolPoolGroups.end() && !it->second.IsEmpty())
-            it->second.DespawnObject(mSpawnedData);
+            it->second.DespawnObject(spawns);
     }
     {
         auto it = mPoolQuestGroups.find(pool_id);
         if (it != mPoolQuestGroups.end() && !it->second.IsEmpty())
-            it->second.DespawnObject(mSpawnedData);
+            it->second.DespawnObject(spawns);
     }
 }
 
@@ -1168,6 +1221,116 @@ template void PoolMgr::UpdatePool<GameObject>(uint32 pool_id, uint32 db_guid_or_
 template void PoolMgr::UpdatePool<Creature>(uint32 pool_id, uint32 db_guid_or_pool_id);
 template void PoolMgr::UpdatePool<Quest>(uint32 pool_id, uint32 db_guid_or_pool_id);
 
+template<typename T>
+bool PoolMgr::IsSpawnedObject(uint32 db_guid_or_pool_id) const
+{
+    ActivePoolData const& spawns = GetSpawnedData(IsPartOfAPool<T>(db_guid_or_pool_id));
+    auto guard = LockSpawnedData(spawns);
+    return spawns.template IsActiveObject<T>(db_guid_or_pool_id);
+}
+
+// a pool's own active state is kept in the shard of its pool tree
+template<>
+bool PoolMgr::IsSpawnedObject<Pool>(uint32 pool_id) const
+{
+    ActivePoolData const& spawns = GetSpawnedData(pool_id);
+    auto guard = LockSpawnedData(spawns);
+    return spawns.IsActiveObject<Pool>(pool_id);
+}
+
+template bool PoolMgr::IsSpawnedObject<GameObject>(uint32 db_guid_or_pool_id) const;
+template bool PoolMgr::IsSpawnedObject<Creature>(uint32 db_guid_or_pool_id) const;
+template bool PoolMgr::IsSpawnedObject<Quest>(uint32 db_guid_or_pool_id) const;
+
+// Assigns every pool tree whose creatures and gameobjects all spawn on the same non instanceable map
+// to that map's shard, only this map's update thread then spawns and despawns them
+void PoolMgr::ShardSpawnedData()
+{
+    static constexpr uint32 SHARED_SPAWNED_DATA = std::numeric_limits<uint32>::max();
+
+    mPoolSpawnedData.clear();
+    mMapSpawnedData.clear();
+
+    std::unordered_map<uint32 /*root pool*/, uint32 /*mapId*/> treeMaps;
+    auto addMap = [this, &treeMaps](uint32 poolId, uint32 mapId)
+    {
+        uint32 rootPoolId = poolId;
+        while (uint32 motherPoolId = IsPartOfAPool<Pool>(rootPoolId))
+            rootPoolId = motherPoolId;
+
+        MapEntry const* mapEntry = sMapStore.LookupEntry(mapId);
+        if (!mapEntry || mapEntry->Instanceable())
+            mapId = SHARED_SPAWNED_DATA;
+
+        auto [itr, inserted] = treeMaps.emplace(rootPoolId, mapId);
+        if (!inserted && itr->second != mapId)
+            itr->second = SHARED_SPAWNED_DATA;
+    };
+
+    for (auto const& [poolId, group] : mPoolCreatureGroups)
+    {
+        for (PoolObject const& obj : group.GetExplicitlyChanced())
+            addMap(poolId, sObjectMgr->GetCreatureData(obj.guid)->mapid);
+        for (PoolObject const& obj : group.GetEqualChanced())
+            addMap(poolId, sObjectMgr->GetCreatureData(obj.guid)->mapid);
+    }
+
+    for (auto const& [poolId, group] : mPoolGameobjectGroups)
+    {
+        for (PoolObject const& obj : group.GetExplicitlyChanced())
+            addMap(poolId, sObjectMgr->GetGameObjectData(obj.guid)->mapid);
+        for (PoolObject const& obj : group.GetEqualChanced())
+            addMap(poolId, sObjectMgr->GetGameObjectData(obj.guid)->mapid);
+    }
+
+    for (auto const& [poolId, group] : mPoolQuestGroups)
+        addMap(poolId, SHARED_SPAWNED_DATA);
+
+    uint32 count = 0;
+    for (auto const& [poolId, poolTemplate] : mPoolTemplate)
+    {
+        uint32 rootPoolId = poolId;
+        while (uint32 motherPoolId = IsPartOfAPool<Pool>(rootPoolId))
+            rootPoolId = motherPoolId;
+
+        auto itr = treeMaps.find(rootPoolId);
+        if (itr == treeMaps.end() || itr->second == SHARED_SPAWNED_DATA)
+            continue;
+
+        mPoolSpawnedData[poolId] = &mMapSpawnedData[itr->second];
+        ++count;
+    }
+
+    LOG_INFO("server.loading", ">> Assigned {} Pools To {} Map Shards", count, mMapSpawnedData.size());
+}
+
+ActivePoolData& PoolMgr::GetActivePoolData(uint32 poolId)
+{
+    auto itr = mPoolSpawnedData.find(poolId);
+    return itr != mPoolSpawnedData.end() ? *itr->second : mSpawnedData;
+}
+
+ActivePoolData const& PoolMgr::GetSpawnedData(uint32 poolId) const
+{
+    auto itr = mPoolSpawnedData.find(poolId);
+    return itr != mPoolSpawnedData.end() ? *itr->second : mSpawnedData;
+}
+
+std::unique_lock<std::recursive_mutex> PoolMgr::LockSpawnedData(ActivePoolData const& spawns) const
+{
+    if (&spawns != &mSpawnedData)
+        return std::unique_lock<std::recursive_mutex>();
+
+    return std::unique_lock<std::recursive_mutex>(mSpawnedDataLock);
+}
+
+uint32 PoolMgr::GetActiveObjectCount(uint32 poolId) const
+{
+    ActivePoolData const& spawns = GetSpawnedData(poolId);
+    auto guard = LockSpawnedData(spawns);
+    return spawns.GetActiveObjectCount(poolId);
+}
+
 PoolTemplateData const* PoolMgr::GetPoolTemplate(uint32 poolId) const
 {
     auto itr = mPoolTemplate.find(poolId);
@@ -22,6 +22,7 @@
 #include "Define.h"
 #include "GameObject.h"
 #include "QuestDef.h"
+#include <mutex>
 
 struct PoolTemplateData
 {
@@ -93,9 +94,12 @@ public:
     std::vector<PoolObject> const& GetExplicitlyChanced() const { return ExplicitlyChanced; }
     std::vector<PoolObject> const& GetEqualChanced() const { return EqualChanced; }
 private:
+    void BuildRollTable();
+
     uint32 poolId;
     PoolObjectList ExplicitlyChanced;
     PoolObjectList EqualChanced;
+    std::vector<float> ExplicitlyChancedRoll;               // running sum of the ExplicitlyChanced chances
 };
 
 typedef std::multimap<uint32, uint32> PooledQuestRelation;
@@ -121,7 +125,7 @@ public:
     uint32 IsPartOfAPool(uint32 db_guid_or_pool_id) const;
 
     template<typename T>
-    bool IsSpawnedObject(uint32 db_guid_or_pool_id) const { return mSpawnedData.IsActiveObject<T>(db_guid_or_pool_id); }
+    bool IsSpawnedObject(uint32 db_guid_or_pool_id) const;
 
     bool CheckPool(uint32 pool_id) const;
 
@@ -143,7 +147,7 @@ public:
     PoolGroup<Creature> const* GetPoolCreatureGroup(uint32 poolId) const;
     PoolGroup<GameObject> const* GetPoolGameObjectGroup(uint32 poolId) const;
     PoolGroup<Pool> const* GetPoolPoolGroup(uint32 poolId) const;
-    ActivePoolData const& GetSpawnedData() const { return mSpawnedData; }
+    uint32 GetActiveObjectCount(uint32 poolId) const;
     uint32 GetCreaturePoolId(uint32 guid) const;
     uint32 GetGameObjectPoolId(uint32 guid) const;
 
@@ -152,6 +156,11 @@ private:
     template<typename T>
     void SpawnPool(uint32 pool_id, uint32 db_guid_or_pool_id);
 
+    void ShardSpawnedData();
+    ActivePoolData& GetActivePoolData(uint32 poolId);
+    ActivePoolData const& GetSpawnedData(uint32 poolId) const;
+    std::unique_lock<std::recursive_mutex> LockSpawnedData(ActivePoolData const& spawns) const;
+
     typedef std::unordered_map<uint32, PoolTemplateData>      PoolTemplateDataMap;
     typedef std::unordered_map<uint32, PoolGroup<Creature>>   PoolGroupCreatureMap;
     typedef std::unordered_map<uint32, PoolGroup<GameObject>> PoolGroupGameObjectMap;
@@ -171,11 +180,20 @@ private:
     SearchMap mQuestSearchMap;
 
     // dynamic data
+    // Pools whose members all spawn on the same non instanceable map keep their state
+    // in that map's shard, it is only touched from that map's update thread.
+    // Quest pools and pools spanning several maps share mSpawnedData, guarded by mSpawnedDataLock.
     ActivePoolData mSpawnedData;
+    mutable std::recursive_mutex mSpawnedDataLock;
+    std::unordered_map<uint32 /*mapId*/, ActivePoolData> mMapSpawnedData;
+    std::unordered_map<uint32 /*poolId*/, ActivePoolData*> mPoolSpawnedData;
 };
 
 #define sPoolMgr PoolMgr::instance()
 
+template<>
+bool PoolMgr::IsSpawnedObject<Pool>(uint32 pool_id) const;
+
 // Method that tell if the creature is part of a pool and return the pool id if yes
 template<>
 inline uint32 PoolMgr::IsPartOfAPool<Creature>(uint32 db_guid) const
@@ -41,6 +41,7 @@
 #include "PacketUtilities.h"
 #include "Pet.h"
 #include "Player.h"
+#include "PlayerLoginCache.h"
 #include "Realm.h"
 #include "QueryHolder.h"
 #include "ScriptMgr.h"
@@ -49,6 +50,7 @@
 #include "Tokenize.h"
 #include "Vehicle.h"
 #include "WardenWin.h"
+#include "WhoListCacheMgr.h"
 #include "World.h"
 #include "WorldGlobals.h"
 #include "WorldPacket.h"
@@ -732,7 +734,17 @@ void WorldSession::LogoutPlayer(bool save)
                 _player->SetUInt32Value(PLAYER_FIELD_BUYBACK_PRICE_1 + eslot, 0);
                 _player->SetUInt32Value(PLAYER_FIELD_BUYBACK_TIMESTAMP_1 + eslot, 0);
             }
-            _player->SaveToDB(false, true);
+
+            if (sPlayerLoginCache->IsEnabled() && sPlayerLoginCache->RecordLogout(_player->GetGUID()))
+            {
+                // commit the logout save on its own so the login cache can be filled once it is stored
+                CharacterDatabaseTransaction trans = CharacterDatabase.BeginTransaction();
+                _player->SaveToDB(trans, false, true);
+                sPlayerLoginCache->AddLogoutSave(_player->GetGUID(), GetAccountId(), CharacterDatabase.AsyncCommitTransaction(trans),
+                    [accountId = GetAccountId(), guid = _player->GetGUID()]() { return LoadLoginQueryHolder(accountId, guid); });
+            }
+            else
+                _player->SaveToDB(false, true);
         }
 
         ///- Leave all channels before player delete...
@@ -1312,6 +1324,15 @@ void WorldSession::SendAddonsInfo()
     SendPacket(&data);
 }
 
+void WorldSession::SetSecurity(AccountTypes security)
+{
+    _security = security;
+
+    // the who list shows the security of online players
+    if (_player)
+        sWhoListCacheMgr->MarkDirty(_player->GetGUID());
+}
+
 void WorldSession::SetPlayer(Player* player)
 {
     _player = player;
@@ -38,6 +38,7 @@
 
 class Creature;
 class GameObject;
+class InstanceMapLoadQueryHolder;
 class InstanceSave;
 class Item;
 class LoginQueryHolder;
@@ -469,7 +470,7 @@ public:
     void SetCurrentVendor(uint32 vendorEntry) { m_currentVendorEntry = vendorEntry; }
 
     ObjectGuid::LowType GetGuidLow() const;
-    void SetSecurity(AccountTypes security) { _security = security; }
+    void SetSecurity(AccountTypes security);
     std::string const& GetRemoteAddress() { return m_Address; }
     void SetPlayer(Player* player);
     uint8 Expansion() const { return m_expansion; }
@@ -650,6 +651,7 @@ public:                                                 // opcodes handlers
     void HandlePlayerLoginOpcode(WorldPacket& recvPacket);
     void HandleCharEnum(PreparedQueryResult result);
     void HandlePlayerLoginFromDB(LoginQueryHolder const& holder);
+    static SQLQueryHolderCallback LoadLoginQueryHolder(uint32 accountId, ObjectGuid guid);
     void HandlePlayerLoginToCharInWorld(Player* pCurrChar);
     void HandlePlayerLoginToCharOutOfWorld(Player* pCurrChar);
     void HandleCharFactionOrRaceChange(WorldPacket& recvData);
@@ -750,7 +752,7 @@ public:                                                 // opcodes handlers
     void HandleGameObjectQueryOpcode(WorldPacket& recvPacket);
 
     void HandleMoveWorldportAckOpcode(WorldPacket& recvPacket);
-    void HandleMoveWorldportAck(); // for server-side calls
+    void HandleMoveWorldportAck(InstanceMapLoadQueryHolder const* prefetched = nullptr); // for server-side calls
 
     void HandleMovementOpcodes(WorldPacket& recvPacket);
     void HandleSetActiveMoverOpcode(WorldPacket& recvData);
@@ -1261,6 +1263,7 @@ private:
     bool m_playerLogout;                                // code processed in LogoutPlayer
     bool m_playerRecentlyLogout;
     bool m_playerSave;
+    ObjectGuid m_instanceLoadPendingGuid;               // player whose far teleport destination instance is being fetched
     LocaleConstant m_sessionDbcLocale;
     LocaleConstant m_sessionDbLocaleIndex;
     std::atomic<uint32> m_latency;
@@ -133,7 +133,7 @@ void WorldSocket::Start()
     LoginDatabasePreparedStatement* stmt = LoginDatabase.GetPreparedStatement(LOGIN_SEL_IP_INFO);
     stmt->SetData(0, ip_address);
 
-    _queryProcessor.AddCallback(LoginDatabase.AsyncQuery(stmt).WithPreparedCallback(std::bind(&WorldSocket::CheckIpCallback, this, std::placeholders::_1)));
+    AddQueryCallback(LoginDatabase.AsyncQuery(stmt).WithPreparedCallback(std::bind(&WorldSocket::CheckIpCallback, this, std::placeholders::_1)));
 }
 
 void WorldSocket::CheckIpCallback(PreparedQueryResult result)
@@ -167,9 +167,9 @@ bool WorldSocket::Update()
     EncryptableAndCompressiblePacket* queued;
     if (_bufferQueue.Dequeue(queued))
     {
-        // Allocate buffer only when it's needed but not on every Update() call.
-        MessageBuffer buffer(_sendBufferSize);
-        std::size_t currentPacketSize;
+        // Small packets are copied together into a buffer, bigger payloads are queued in their own storage
+        // right after their header, without copying, and go out in the same gathered write.
+        MessageBuffer buffer(0);
         do
         {
             queued->CompressIfNeeded();
@@ -177,32 +177,28 @@ bool WorldSocket::Update()
             if (queued->NeedsEncryption())
                 _authCrypt.EncryptSend(header.header, header.getHeaderLength());
 
-            currentPacketSize = queued->size() + header.getHeaderLength();
+            bool const copyPayload = queued->size() <= MaxCopiedPayloadSize;
+            std::size_t const bufferedSize = header.getHeaderLength() + (copyPayload ? queued->size() : 0);
 
-            if (buffer.GetRemainingSpace() < currentPacketSize)
+            if (buffer.GetRemainingSpace() < bufferedSize)
             {
-                QueuePacket(std::move(buffer));
-                buffer.Resize(_sendBufferSize);
+                if (buffer.GetActiveSize() > 0)
+                    QueuePacket(std::move(buffer));
+
+                // Allocate buffer only when it's needed but not on every Update() call.
+                buffer.Resize(std::max(_sendBufferSize, bufferedSize));
             }
 
-            if (buffer.GetRemainingSpace() >= currentPacketSize)
+            buffer.Write(header.header, header.getHeaderLength());
+            if (copyPayload)
             {
-                buffer.Write(header.header, header.getHeaderLength());
                 if (!queued->empty())
                     buffer.Write(queued->contents(), queued->size());
             }
-            else    // Single packet larger than current buffer size
+            else
             {
-                // Resize buffer to fit current packet
-                buffer.Resize(currentPacketSize);
-
-                // Grow future buffers to current packet size if still below limit
-                if (currentPacketSize <= 65536)
-                    _sendBufferSize = currentPacketSize;
-
-                buffer.Write(header.header, header.getHeaderLength());
-                if (!queued->empty())
-                    buffer.Write(queued->contents(), queued->size());
+                QueuePacket(std::move(buffer));             // leaves buffer empty, reallocated for the next small packet
+                QueuePacket(MessageBuffer(queued->Move()));
             }
 
             delete queued;
@@ -213,13 +209,26 @@ bool WorldSocket::Update()
     }
 
     if (!BaseSocket::Update())
+    {
+        LOG_DEBUG("network", "WorldSocket::Update: {} closed, peak write queue {} bytes, {} writes had to wait for the socket",
+            GetRemoteIpAddress().to_string(), GetWriteQueuePeakBytes(), GetWriteWouldBlockCount());
         return false;
+    }
 
     _queryProcessor.ProcessReadyCallbacks();
+    if (!_queryProcessor.Empty())
+        QueueDelayedUpdate(SOCKET_CALLBACK_POLL_INTERVAL);
 
     return true;
 }
 
+void WorldSocket::AddQueryCallback(QueryCallback&& callback)
+{
+    // the periodic sweep skips open sockets, poll until the database has answered
+    _queryProcessor.AddCallback(std::move(callback));
+    QueueDelayedUpdate(SOCKET_CALLBACK_POLL_INTERVAL);
+}
+
 void WorldSocket::HandleSendAuthSession()
 {
     WorldPacket packet(SMSG_AUTH_CHALLENGE, 40);
@@ -525,6 +534,7 @@ void WorldSocket::SendPacket(WorldPacket const& packet)
         sPacketLog->LogPacket(packet, SERVER_TO_CLIENT, GetRemoteIpAddress(), GetRemotePort());
 
     _bufferQueue.Enqueue(new EncryptableAndCompressiblePacket(packet, _authCrypt.IsInitialized()));
+    QueueUpdate();
 }
 
 void WorldSocket::HandleAuthSession(WorldPacket & recvPacket)
@@ -550,7 +560,7 @@ void WorldSocket::HandleAuthSession(WorldPacket & recvPacket)
     stmt->SetData(0, int32(realm.Id.Realm));
     stmt->SetData(1, authSession->Account);
 
-    _queryProcessor.AddCallback(LoginDatabase.AsyncQuery(stmt).WithPreparedCallback(std::bind(&WorldSocket::HandleAuthSessionCallback, this, authSession, std::placeholders::_1)));
+    AddQueryCallback(LoginDatabase.AsyncQuery(stmt).WithPreparedCallback(std::bind(&WorldSocket::HandleAuthSessionCallback, this, authSession, std::placeholders::_1)));
 }
 
 void WorldSocket::HandleAuthSessionCallback(std::shared_ptr<ClientAuthSession> authSession, PreparedQueryResult result)
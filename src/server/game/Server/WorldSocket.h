@@ -103,6 +103,7 @@ protected:
     ReadDataHandlerResult ReadDataHandler();
 
 private:
+    void AddQueryCallback(QueryCallback&& callback);
     void CheckIpCallback(PreparedQueryResult result);
 
     /// writes network.opcode log
@@ -132,7 +133,10 @@ private:
     MessageBuffer _headerBuffer;
     MessageBuffer _packetBuffer;
     MPSCQueue<EncryptableAndCompressiblePacket, &EncryptableAndCompressiblePacket::SocketQueueLink> _bufferQueue;
-    std::size_t _sendBufferSize;
+    std::size_t _sendBufferSize;                            // size of the buffers small packets are copied into
+
+    // bigger payloads are sent from the packet's own storage instead of being copied
+    static constexpr std::size_t MaxCopiedPayloadSize = 1024;
 
     QueryCallbackProcessor _queryProcessor;
     std::string _ipCountry;
@@ -69,6 +69,7 @@
 #include "PetitionMgr.h"
 #include "Player.h"
 #include "PlayerDump.h"
+#include "PlayerLoginCache.h"
 #include "PoolMgr.h"
 #include "RaceMgr.h"
 #include "Realm.h"
@@ -912,8 +913,6 @@ void World::SetInitialWorldSettings()
     // our speed up
     _timers[WUPDATE_5_SECS].SetInterval(5 * IN_MILLISECONDS);
 
-    _timers[WUPDATE_WHO_LIST].SetInterval(5 * IN_MILLISECONDS); // update who list cache every 5 seconds
-
     _mail_expire_check_timer = GameTime::GetGameTime() + 6h;
 
     ///- Initialize MapMgr
@@ -1136,11 +1135,9 @@ void World::Update(uint32 diff)
         CharacterDatabase.Execute(stmt);
     }
 
-    ///- Update Who List Cache
-    if (_timers[WUPDATE_WHO_LIST].Passed())
+    ///- Update Who List Cache, only the players that changed since the last tick
     {
         METRIC_TIMER("world_update_time", METRIC_TAG("type", "Update who list"));
-        _timers[WUPDATE_WHO_LIST].Reset();
         sWhoListCacheMgr->Update();
     }
 
@@ -1267,6 +1264,7 @@ void World::Update(uint32 diff)
         METRIC_TIMER("world_update_time", METRIC_TAG("type", "Process query callbacks"));
         // execute callbacks from sql queries that were queued recently
         ProcessQueryCallbacks();
+        sPlayerLoginCache->Update();
     }
 
     /// <li> Update uptime table
@@ -1673,6 +1671,7 @@ void World::ResetDailyQuests()
 {
     CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_QUEST_STATUS_DAILY);
     CharacterDatabase.Execute(stmt);
+    sPlayerLoginCache->InvalidateAll();
 
     WorldSessionMgr::SessionMap const& sessionMap = sWorldSessionMgr->GetAllSessions();
     for (WorldSessionMgr::SessionMap::const_iterator itr = sessionMap.begin(); itr != sessionMap.end(); ++itr)
@@ -1709,6 +1708,7 @@ void World::ResetWeeklyQuests()
 {
     CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_QUEST_STATUS_WEEKLY);
     CharacterDatabase.Execute(stmt);
+    sPlayerLoginCache->InvalidateAll();
 
     WorldSessionMgr::SessionMap const& sessionMap = sWorldSessionMgr->GetAllSessions();
     for (WorldSessionMgr::SessionMap::const_iterator itr = sessionMap.begin(); itr != sessionMap.end(); ++itr)
@@ -1728,6 +1728,7 @@ void World::ResetMonthlyQuests()
 
     CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_QUEST_STATUS_MONTHLY);
     CharacterDatabase.Execute(stmt);
+    sPlayerLoginCache->InvalidateAll();
 
     WorldSessionMgr::SessionMap const& sessionMap = sWorldSessionMgr->GetAllSessions();
     for (WorldSessionMgr::SessionMap::const_iterator itr = sessionMap.begin(); itr != sessionMap.end(); ++itr)
@@ -1743,6 +1744,7 @@ void World::ResetEventSeasonalQuests(uint16 event_id)
     CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_QUEST_STATUS_SEASONAL);
     stmt->SetData(0, event_id);
     CharacterDatabase.Execute(stmt);
+    sPlayerLoginCache->InvalidateAll();
 
     WorldSessionMgr::SessionMap const& sessionMap = sWorldSessionMgr->GetAllSessions();
     for (WorldSessionMgr::SessionMap::const_iterator itr = sessionMap.begin(); itr != sessionMap.end(); ++itr)
@@ -1766,6 +1768,7 @@ void World::ResetRandomBG()
 
     CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_BATTLEGROUND_RANDOM);
     CharacterDatabase.Execute(stmt);
+    sPlayerLoginCache->InvalidateAll();
 
     WorldSessionMgr::SessionMap const& sessionMap = sWorldSessionMgr->GetAllSessions();
     for (WorldSessionMgr::SessionMap::const_iterator itr = sessionMap.begin(); itr != sessionMap.end(); ++itr)
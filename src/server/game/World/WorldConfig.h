@@ -100,6 +100,7 @@ enum ServerConfigs
     CONFIG_ENABLE_MMAPS,
     CONFIG_ENABLE_LOGIN_AFTER_DC,
     CONFIG_DONT_CACHE_RANDOM_MOVEMENT_PATHS,
+    CONFIG_PLAYER_LOGIN_CACHE_ENABLED,
     CONFIG_QUEST_IGNORE_AUTO_ACCEPT,
     CONFIG_QUEST_IGNORE_AUTO_COMPLETE,
     CONFIG_QUEST_ENABLE_QUEST_TRACKER,
@@ -168,6 +169,8 @@ enum ServerConfigs
     CONFIG_INTERVAL_MAPUPDATE,
     CONFIG_INTERVAL_CHANGEWEATHER,
     CONFIG_INTERVAL_DISCONNECT_TOLERANCE,
+    CONFIG_PLAYER_LOGIN_CACHE_MAX_ENTRIES,
+    CONFIG_PLAYER_LOGIN_CACHE_DURATION,
     CONFIG_INTERVAL_SAVE,
     CONFIG_PORT_WORLD,
     CONFIG_SOCKET_TIMEOUTTIME,
@@ -236,6 +239,7 @@ enum ServerConfigs
     CONFIG_CHATFLOOD_ADDON_MESSAGE_DELAY,
     CONFIG_CHATFLOOD_MUTE_TIME,
     CONFIG_EVENT_ANNOUNCE,
+    CONFIG_EVENT_MAP_TASKS_PER_UPDATE,
     CONFIG_CREATURE_FAMILY_ASSISTANCE_DELAY,
     CONFIG_CREATURE_FAMILY_ASSISTANCE_PERIOD,
     CONFIG_CREATURE_FAMILY_FLEE_DELAY,
@@ -267,6 +271,7 @@ enum ServerConfigs
     CONFIG_BATTLEGROUND_QUEUE_ANNOUNCER_TIMER,
     CONFIG_BATTLEGROUND_PREMATURE_FINISH_TIMER,
     CONFIG_BATTLEGROUND_PREMADE_GROUP_WAIT_FOR_MATCH,
+    CONFIG_BATTLEGROUND_MAP_POOL_SIZE,
     CONFIG_BATTLEGROUND_REPORT_AFK_TIMER,
     CONFIG_BATTLEGROUND_REPORT_AFK,
     CONFIG_BATTLEGROUND_INVITATION_TYPE,
@@ -300,6 +305,7 @@ enum ServerConfigs
     CONFIG_PVP_TOKEN_COUNT,
     CONFIG_ENABLE_SINFO_LOGIN,
     CONFIG_NUMTHREADS,
+    CONFIG_MAP_OBJECT_UPDATE_THREADS,
     CONFIG_LOGDB_CLEARINTERVAL,
     CONFIG_LOGDB_CLEARTIME,
     CONFIG_MAX_ALLOWED_MMR_DROP,
@@ -395,6 +401,7 @@ enum ServerConfigs
     CONFIG_RESPAWN_DYNAMICMINIMUM_CREATURE,
     CONFIG_RESPAWN_DYNAMIC_ESCORTNPC,
     CONFIG_RESPAWN_FORCE_COMPATIBILITY_MODE,
+    CONFIG_RESPAWN_SAVE_INTERVAL,
     RATE_HEALTH,
     RATE_POWER_MANA,
     RATE_POWER_RAGE_INCOME,
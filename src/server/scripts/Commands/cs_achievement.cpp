@@ -20,6 +20,7 @@
 #include "CommandScript.h"
 #include "Language.h"
 #include "Player.h"
+#include "PlayerLoginCache.h"
 #include "RBAC.h"
 
 using namespace Acore::ChatCommands;
@@ -92,6 +93,7 @@ public:
             stmt->SetData(0, uint16(AT_LOGIN_CHECK_ACHIEVS));
             stmt->SetData(1, player->GetGUID().GetCounter());
             CharacterDatabase.Execute(stmt);
+            sPlayerLoginCache->Invalidate(player->GetGUID());
         }
 
         return true;
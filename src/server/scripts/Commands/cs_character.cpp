@@ -25,6 +25,7 @@
 #include "ObjectMgr.h"
 #include "Player.h"
 #include "PlayerDump.h"
+#include "PlayerLoginCache.h"
 #include "RBAC.h"
 #include "ReputationMgr.h"
 #include "Timer.h"
@@ -425,6 +426,7 @@ public:
                 stmt->SetData(0, uint16(AT_LOGIN_RENAME));
                 stmt->SetData(1, player->GetGUID().GetCounter());
                 CharacterDatabase.Execute(stmt);
+                sPlayerLoginCache->Invalidate(player->GetGUID());
             }
         }
 
@@ -480,6 +482,7 @@ public:
             stmt->SetData(0, static_cast<uint16>(AT_LOGIN_CUSTOMIZE));
             stmt->SetData(1, player->GetGUID().GetCounter());
             CharacterDatabase.Execute(stmt);
+            sPlayerLoginCache->Invalidate(player->GetGUID());
         }
 
         return true;
@@ -504,6 +507,7 @@ public:
             stmt->SetData(0, uint16(AT_LOGIN_CHANGE_FACTION));
             stmt->SetData(1, player->GetGUID().GetCounter());
             CharacterDatabase.Execute(stmt);
+            sPlayerLoginCache->Invalidate(player->GetGUID());
         }
 
         return true;
@@ -528,6 +532,7 @@ public:
             stmt->SetData(0, uint16(AT_LOGIN_CHANGE_RACE));
             stmt->SetData(1, player->GetGUID().GetCounter());
             CharacterDatabase.Execute(stmt);
+            sPlayerLoginCache->Invalidate(player->GetGUID());
         }
 
         return true;
@@ -121,7 +121,7 @@ private:
             return false;
         }
 
-        uint32 activeCount = sPoolMgr->GetSpawnedData().GetActiveObjectCount(poolId);
+        uint32 activeCount = sPoolMgr->GetActiveObjectCount(poolId);
         handler->PSendSysMessage(LANG_POOL_INFO_HEADER, poolId,
             tpl->Description.empty() ? "(none)" : tpl->Description,
             tpl->MaxLimit, activeCount);
@@ -159,7 +159,7 @@ private:
 
                 auto printSubPool = [&](PoolObject const& obj)
                 {
-                    bool active = sPoolMgr->GetSpawnedData().IsActiveObject<Pool>(obj.guid);
+                    bool active = sPoolMgr->IsSpawnedObject<Pool>(obj.guid);
                     PoolTemplateData const* subTpl = sPoolMgr->GetPoolTemplate(obj.guid);
                     std::string desc = subTpl ? subTpl->Description : "Unknown";
 
@@ -831,7 +831,7 @@ public:
                 {
                     handler->SendSysMessage(LANG_CMD_QUEST_STATUS_CONDITION);
 
-                    ConditionList conditions = sConditionMgr->GetConditionsForNotGroupedEntry(CONDITION_SOURCE_TYPE_QUEST_AVAILABLE, entry);
+                    ConditionList const& conditions = sConditionMgr->GetConditionsForNotGroupedEntry(CONDITION_SOURCE_TYPE_QUEST_AVAILABLE, entry);
                     ConditionSourceInfo srcInfo = ConditionSourceInfo(player);
                     for (Condition* cond : conditions)
                     {
@@ -21,6 +21,7 @@
 #include "Language.h"
 #include "Pet.h"
 #include "Player.h"
+#include "PlayerLoginCache.h"
 #include "RBAC.h"
 #include "ScriptMgr.h"
 #include "WorldSessionMgr.h"
@@ -199,6 +200,7 @@ public:
             stmt->SetData(0, uint16(AT_LOGIN_RESET_SPELLS));
             stmt->SetData(1, playerTarget->GetGUID().GetCounter());
             CharacterDatabase.Execute(stmt);
+            sPlayerLoginCache->Invalidate(playerTarget->GetGUID());
 
             handler->PSendSysMessage(LANG_RESET_SPELLS_OFFLINE, target->GetName());
         }
@@ -261,6 +263,7 @@ public:
             stmt->SetData(0, uint16(AT_LOGIN_RESET_TALENTS | AT_LOGIN_RESET_PET_TALENTS));
             stmt->SetData(1, target->GetGUID().GetCounter());
             CharacterDatabase.Execute(stmt);
+            sPlayerLoginCache->Invalidate(target->GetGUID());
 
             std::string nameLink = handler->playerLink(target->GetName());
             handler->PSendSysMessage(LANG_RESET_TALENTS_OFFLINE, nameLink);
@@ -33,6 +33,15 @@
 
 using boost::asio::ip::tcp;
 
+/*
+ * Sockets are serviced when they have something to do: sending a packet calls Socket::QueueUpdate(),
+ * which runs the socket's Update() on this thread, pending database callbacks are polled through
+ * Socket::QueueDelayedUpdate() and new sockets are started as soon as they are added.
+ * The sweep every SOCKET_SWEEP_INTERVAL only updates sockets that are closing or closed, to flush
+ * and drop them, and the new sockets still waiting for their PROXY header.
+ */
+#define SOCKET_SWEEP_INTERVAL std::chrono::milliseconds(10)
+
 template<class SocketType>
 class NetworkThread
 {
@@ -89,6 +98,8 @@ public:
         ++_connections;
         _newSockets.emplace_back(sock);
         SocketAdded(sock);
+
+        Acore::Asio::post(_ioContext, [this]() { AddNewSockets(); });
     }
 
     IoContextTcpSocket* GetSocketForAccept() { return &_acceptSocket; }
@@ -179,7 +190,7 @@ protected:
     {
         LOG_DEBUG("misc", "Network Thread Starting");
 
-        _updateTimer.expires_at(std::chrono::steady_clock::now() + std::chrono::milliseconds(1));
+        _updateTimer.expires_at(std::chrono::steady_clock::now() + SOCKET_SWEEP_INTERVAL);
         _updateTimer.async_wait([this](boost::system::error_code const&) { Update(); });
         _ioContext.run();
 
@@ -193,13 +204,16 @@ protected:
         if (_stopped)
             return;
 
-        _updateTimer.expires_at(std::chrono::steady_clock::now() + std::chrono::milliseconds(1));
+        _updateTimer.expires_at(std::chrono::steady_clock::now() + SOCKET_SWEEP_INTERVAL);
         _updateTimer.async_wait([this](boost::system::error_code const&) { Update(); });
 
         AddNewSockets();
 
-        _sockets.erase(std::remove_if(_sockets.begin(), _sockets.end(), [this](std::shared_ptr<SocketType> sock)
+        _sockets.erase(std::remove_if(_sockets.begin(), _sockets.end(), [this](std::shared_ptr<SocketType> const& sock)
         {
+            if (sock->IsOpen())
+                return false;
+
             if (!sock->Update())
             {
                 if (sock->IsOpen())
@@ -20,18 +20,31 @@
 
 #include "Log.h"
 #include "MessageBuffer.h"
+#include <algorithm>
 #include <atomic>
 #include <boost/asio/io_context.hpp>
 #include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/post.hpp>
+#include <boost/asio/steady_timer.hpp>
+#include <chrono>
+#include <deque>
 #include <memory>
-#include <queue>
 #include <type_traits>
+#include <vector>
 
 using boost::asio::ip::tcp;
 
 #define READ_BLOCK_SIZE 4096
+#define WRITE_MAX_BUFFERS 64                                // buffers handed to a single gathered write (writev)
+#define SOCKET_CALLBACK_POLL_INTERVAL std::chrono::milliseconds(1) // how often Update() runs while database callbacks are pending
 #ifdef BOOST_ASIO_HAS_IOCP
 #define AC_SOCKET_USE_IOCP
+#define AC_SOCKET_BACKEND "iocp"
+#elif defined(BOOST_ASIO_HAS_IO_URING) && defined(BOOST_ASIO_DISABLE_EPOLL)
+#define AC_SOCKET_USE_IO_URING                              // built WITH_IO_URING, sends are submitted to the ring as well
+#define AC_SOCKET_BACKEND "io_uring"
+#else
+#define AC_SOCKET_BACKEND "reactor"
 #endif
 
 // Specialize boost socket for io_context executor instead of type-erased any_io_executor
@@ -67,9 +80,9 @@ template<class T>
 class Socket : public std::enable_shared_from_this<T>
 {
 public:
-    explicit Socket(IoContextTcpSocket&& socket) : _socket(std::move(socket)), _remoteAddress(_socket.remote_endpoint().address()),
-        _remotePort(_socket.remote_endpoint().port()), _readBuffer(), _state(SocketState::Open), _isWritingAsync(false),
-        _proxyHeaderReadingState(PROXY_HEADER_READING_STATE_NOT_STARTED)
+    explicit Socket(IoContextTcpSocket&& socket) : _socket(std::move(socket)), _delayedUpdateTimer(_socket.get_executor()), _remoteAddress(_socket.remote_endpoint().address()),
+        _remotePort(_socket.remote_endpoint().port()), _readBuffer(), _writeQueueBytes(0), _writeQueuePeakBytes(0), _writeWouldBlockCount(0),
+        _state(SocketState::Open), _isWritingAsync(false), _updateQueued(false), _delayedUpdateQueued(false), _proxyHeaderReadingState(PROXY_HEADER_READING_STATE_NOT_STARTED)
     {
         _readBuffer.Resize(READ_BLOCK_SIZE);
     }
@@ -97,8 +110,13 @@ public:
             return true;
         }
 
+#ifdef AC_SOCKET_USE_IO_URING
+        if (!_writeQueue.empty())
+            AsyncProcessQueue();
+#else
         for (; HandleQueue();)
             ;
+#endif
 #endif
 
         return true;
@@ -158,15 +176,52 @@ public:
 
     void QueuePacket(MessageBuffer&& buffer)
     {
-        _writeQueue.push(std::move(buffer));
+        _writeQueueBytes += buffer.GetActiveSize();
+        _writeQueuePeakBytes = std::max(_writeQueuePeakBytes, _writeQueueBytes);
+        _writeQueue.push_back(std::move(buffer));
 
 #ifdef AC_SOCKET_USE_IOCP
         AsyncProcessQueue();
 #endif
     }
 
+    /// Runs Update() on the socket's network thread as soon as possible instead of at its next sweep, callable from any thread
+    void QueueUpdate()
+    {
+        if (_updateQueued.exchange(true))
+            return;
+
+        boost::asio::post(_socket.get_executor(), [self = this->shared_from_this()]()
+        {
+            self->_updateQueued = false;
+            self->Update();                                 // a closed socket is dropped by the next sweep
+        });
+    }
+
+    /// Runs Update() on the socket's network thread after delay, for work that completes without a signal like database callbacks.
+    /// Only callable from the socket's network thread, calls made until then are merged into one Update()
+    void QueueDelayedUpdate(std::chrono::steady_clock::duration delay)
+    {
+        if (_delayedUpdateQueued)
+            return;
+
+        _delayedUpdateQueued = true;
+        _delayedUpdateTimer.expires_after(delay);
+        _delayedUpdateTimer.async_wait([self = this->shared_from_this()](boost::system::error_code const& error)
+        {
+            self->_delayedUpdateQueued = false;
+            if (!error)
+                self->Update();
+        });
+    }
+
     [[nodiscard]] ProxyHeaderReadingState GetProxyHeaderReadingState() const { return _proxyHeaderReadingState; }
 
+    // Backpressure of the write queue, only to be read from the socket's network thread
+    [[nodiscard]] std::size_t GetWriteQueueBytes() const { return _writeQueueBytes; }          // queued, not accepted by the kernel yet
+    [[nodiscard]] std::size_t GetWriteQueuePeakBytes() const { return _writeQueuePeakBytes; }
+    [[nodiscard]] uint32 GetWriteWouldBlockCount() const { return _writeWouldBlockCount; }     // writes that had to wait for the socket
+
     [[nodiscard]] bool IsOpen() const { return _state.load() == SocketState::Open; }
 
     void CloseSocket()
@@ -210,10 +265,15 @@ protected:
 
         _isWritingAsync = true;
 
-#ifdef AC_SOCKET_USE_IOCP
+#if defined(AC_SOCKET_USE_IOCP)
         MessageBuffer& buffer = _writeQueue.front();
         _socket.async_write_some(boost::asio::buffer(buffer.GetReadPointer(), buffer.GetActiveSize()), std::bind(&Socket<T>::WriteHandler,
             this->shared_from_this(), std::placeholders::_1, std::placeholders::_2));
+#elif defined(AC_SOCKET_USE_IO_URING)
+        // the queued buffers stay in place until the handler runs, only new ones are appended to the deque meanwhile
+        FillWriteBuffers();
+        _socket.async_write_some(_writeBuffers, std::bind(&Socket<T>::GatheredWriteHandler,
+            this->shared_from_this(), std::placeholders::_1, std::placeholders::_2));
 #else
         _socket.async_wait(boost::asio::socket_base::wait_write, [self = this->shared_from_this()](boost::system::error_code error)
         {
@@ -366,9 +426,10 @@ private:
         {
             _isWritingAsync = false;
             _writeQueue.front().ReadCompleted(transferedBytes);
+            _writeQueueBytes -= transferedBytes;
 
             if (!_writeQueue.front().GetActiveSize())
-                _writeQueue.pop();
+                _writeQueue.pop_front();
 
             if (!_writeQueue.empty())
                 AsyncProcessQueue();
@@ -381,6 +442,26 @@ private:
 
 #else
 
+#ifdef AC_SOCKET_USE_IO_URING
+    void GatheredWriteHandler(boost::system::error_code error, std::size_t transferedBytes)
+    {
+        _isWritingAsync = false;
+
+        if (error)
+        {
+            CloseSocket();
+            return;
+        }
+
+        WriteCompleted(transferedBytes);
+
+        if (!_writeQueue.empty())
+            AsyncProcessQueue();
+        else if (_state.load() == SocketState::Closing)
+            CloseSocket();
+    }
+#endif
+
     void WriteHandlerWrapper(boost::system::error_code /*error*/, std::size_t /*transferedBytes*/)
     {
         _isWritingAsync = false;
@@ -392,21 +473,20 @@ private:
         if (_writeQueue.empty())
             return false;
 
-        MessageBuffer& queuedMessage = _writeQueue.front();
-
-        std::size_t bytesToSend = queuedMessage.GetActiveSize();
+        FillWriteBuffers();
 
         boost::system::error_code error;
-        std::size_t bytesSent = _socket.write_some(boost::asio::buffer(queuedMessage.GetReadPointer(), bytesToSend), error);
+        std::size_t bytesSent = _socket.write_some(_writeBuffers, error);
 
         if (error)
         {
             if (error == boost::asio::error::would_block || error == boost::asio::error::try_again)
             {
+                ++_writeWouldBlockCount;
                 return AsyncProcessQueue();
             }
 
-            _writeQueue.pop();
+            PopWriteQueueFront();
 
             if (_state.load() == SocketState::Closing && _writeQueue.empty())
             {
@@ -417,7 +497,7 @@ private:
         }
         else if (bytesSent == 0)
         {
-            _writeQueue.pop();
+            PopWriteQueueFront();
 
             if (_state.load() == SocketState::Closing && _writeQueue.empty())
             {
@@ -426,14 +506,13 @@ private:
 
             return false;
         }
-        else if (bytesSent < bytesToSend) // now n > 0
+
+        if (WriteCompleted(bytesSent)) // partial write, wait until the socket accepts more
         {
-            queuedMessage.ReadCompleted(bytesSent);
+            ++_writeWouldBlockCount;
             return AsyncProcessQueue();
         }
 
-        _writeQueue.pop();
-
         if (_state.load() == SocketState::Closing && _writeQueue.empty())
         {
             CloseSocket();
@@ -441,19 +520,64 @@ private:
 
         return !_writeQueue.empty();
     }
+
+    // everything queued goes out in a single gathered write, up to WRITE_MAX_BUFFERS buffers
+    void FillWriteBuffers()
+    {
+        _writeBuffers.clear();
+        for (MessageBuffer& queuedMessage : _writeQueue)
+        {
+            if (_writeBuffers.size() == WRITE_MAX_BUFFERS)
+                break;
+
+            _writeBuffers.emplace_back(queuedMessage.GetReadPointer(), queuedMessage.GetActiveSize());
+        }
+    }
+
+    // drops the fully sent buffers, returns true if the first one left was partially sent
+    bool WriteCompleted(std::size_t bytesSent)
+    {
+        _writeQueueBytes -= bytesSent;
+
+        while (bytesSent && bytesSent >= _writeQueue.front().GetActiveSize())
+        {
+            bytesSent -= _writeQueue.front().GetActiveSize();
+            _writeQueue.pop_front();
+        }
+
+        if (!bytesSent)
+            return false;
+
+        _writeQueue.front().ReadCompleted(bytesSent);
+        return true;
+    }
+
+    void PopWriteQueueFront()
+    {
+        _writeQueueBytes -= _writeQueue.front().GetActiveSize();
+        _writeQueue.pop_front();
+    }
 #endif
 
     IoContextTcpSocket _socket;
+    boost::asio::steady_timer _delayedUpdateTimer;
 
     boost::asio::ip::address _remoteAddress;
     uint16 _remotePort;
 
     MessageBuffer _readBuffer;
-    std::queue<MessageBuffer> _writeQueue;
+    std::deque<MessageBuffer> _writeQueue;
+    std::vector<boost::asio::const_buffer> _writeBuffers;   // reused for every gathered write
+
+    std::size_t _writeQueueBytes;
+    std::size_t _writeQueuePeakBytes;
+    uint32 _writeWouldBlockCount;
 
     std::atomic<SocketState> _state;
 
     bool _isWritingAsync;
+    std::atomic<bool> _updateQueued;
+    bool _delayedUpdateQueued;
 
     ProxyHeaderReadingState _proxyHeaderReadingState;
 };
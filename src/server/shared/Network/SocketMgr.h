@@ -68,6 +68,8 @@ public:
             _threads[i].Start();
 
         _acceptor->SetSocketFactory([this]() { return GetSocketForAccept(); });
+
+        LOG_INFO("network", "Listening on {}:{} with {} network thread(s), socket backend: {}", bindIp, port, threadCount, AC_SOCKET_BACKEND);
         return true;
     }
 
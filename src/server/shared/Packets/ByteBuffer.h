@@ -444,6 +444,14 @@ public:
     [[nodiscard]] std::size_t size() const { return _storage.size(); }
     [[nodiscard]] bool empty() const { return _storage.empty(); }
 
+    // hands the storage over (see MessageBuffer::Move for the reverse), the buffer is left empty
+    std::vector<uint8>&& Move() noexcept
+    {
+        _rpos = 0;
+        _wpos = 0;
+        return std::move(_storage);
+    }
+
     void resize(std::size_t newsize)
     {
         _storage.resize(newsize, 0);
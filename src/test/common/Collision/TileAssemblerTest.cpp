@@ -0,0 +1,254 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * vmap4_assembler: converting the same raw vmap data on one or several
+ * threads must write byte identical .vmtree, .vmtile and .vmo files.
+ * The raw data is generated: M2 models used by many spawns, WMO models with
+ * bounds, spawns crossing tiles and a map with a global WMO only.
+ */
+
+#include "MapTree.h"
+#include "TileAssembler.h"
+#include "VMapDefinitions.h"
+#include "gtest/gtest.h"
+#include <boost/filesystem.hpp>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <random>
+
+namespace
+{
+
+namespace fs = boost::filesystem;
+
+class RawWriter
+{
+public:
+    explicit RawWriter(fs::path const& path) : _file(path.string(), std::ios::binary) { }
+
+    template<class T>
+    void Write(T const& value) { _file.write(reinterpret_cast<char const*>(&value), sizeof(T)); }
+
+    void Write(char const* data, std::size_t size) { _file.write(data, size); }
+
+private:
+    std::ofstream _file;
+};
+
+void WriteRawModel(fs::path const& path, std::mt19937& rng, uint32 groups, uint32 vertexCount)
+{
+    std::uniform_real_distribution<float> coord(-20.0f, 20.0f);
+
+    RawWriter writer(path);
+    writer.Write(VMAP::RAW_VMAP_MAGIC, 8);
+    writer.Write(groups * vertexCount);
+    writer.Write(groups);
+    writer.Write(uint32(rng() % 1000));                 // RootWMOID
+
+    for (uint32 g = 0; g < groups; ++g)
+    {
+        std::vector<G3D::Vector3> vertices;
+        for (uint32 i = 0; i < vertexCount; ++i)
+            vertices.emplace_back(coord(rng), coord(rng), coord(rng));
+
+        G3D::AABox bounds(vertices.front(), vertices.front());
+        for (G3D::Vector3 const& vertex : vertices)
+            bounds.merge(vertex);
+
+        writer.Write(uint32(0));                        // mogpflags
+        writer.Write(g);                                // GroupWMOID
+        writer.Write(bounds.low());
+        writer.Write(bounds.high());
+        writer.Write(uint32(0));                        // liquidflags
+
+        writer.Write("GRP ", 4);
+        writer.Write(int32(4));
+        writer.Write(uint32(0));                        // branches
+
+        std::vector<uint16> indexes;
+        for (uint32 i = 0; i + 2 < vertexCount; ++i)
+        {
+            indexes.push_back(i);
+            indexes.push_back(i + 1);
+            indexes.push_back(i + 2);
+        }
+
+        writer.Write("INDX", 4);
+        writer.Write(int32(4 + indexes.size() * sizeof(uint16)));
+        writer.Write(uint32(indexes.size()));
+        writer.Write(reinterpret_cast<char const*>(indexes.data()), indexes.size() * sizeof(uint16));
+
+        writer.Write("VERT", 4);
+        writer.Write(int32(4 + vertices.size() * sizeof(G3D::Vector3)));
+        writer.Write(uint32(vertices.size()));
+        writer.Write(reinterpret_cast<char const*>(vertices.data()), vertices.size() * sizeof(G3D::Vector3));
+    }
+}
+
+void WriteSpawn(RawWriter& dirBin, uint32 mapId, uint32 tileX, uint32 tileY, VMAP::ModelSpawn const& spawn)
+{
+    dirBin.Write(mapId);
+    dirBin.Write(tileX);
+    dirBin.Write(tileY);
+    dirBin.Write(spawn.flags);
+    dirBin.Write(spawn.adtId);
+    dirBin.Write(spawn.ID);
+    dirBin.Write(spawn.iPos);
+    dirBin.Write(spawn.iRot);
+    dirBin.Write(spawn.iScale);
+    if (spawn.flags & VMAP::MOD_HAS_BOUND)
+    {
+        dirBin.Write(spawn.iBound.low());
+        dirBin.Write(spawn.iBound.high());
+    }
+    dirBin.Write(uint32(spawn.name.size()));
+    dirBin.Write(spawn.name.data(), spawn.name.size());
+}
+
+std::map<std::string, std::string> ReadOutput(fs::path const& dir)
+{
+    std::map<std::string, std::string> files;
+    for (fs::directory_entry const& entry : fs::directory_iterator(dir))
+    {
+        std::ifstream file(entry.path().string(), std::ios::binary);
+        files[entry.path().filename().string()].assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+    return files;
+}
+
+class TileAssemblerTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        _root = fs::temp_directory_path() / fs::unique_path("ac_tileassembler_%%%%%%%%");
+        fs::create_directories(_root / "raw");
+
+        std::mt19937 rng(12340);
+        std::uniform_real_distribution<float> position(0.0f, 533.0f);
+        std::uniform_real_distribution<float> angle(0.0f, 360.0f);
+
+        for (uint32 i = 0; i < 6; ++i)
+            WriteRawModel(_root / "raw" / ("m2_" + std::to_string(i) + ".m2"), rng, 1, 12 + i * 5);
+        for (uint32 i = 0; i < 3; ++i)
+            WriteRawModel(_root / "raw" / ("wmo_" + std::to_string(i) + ".wmo"), rng, 2 + i, 20);
+
+        RawWriter dirBin(_root / "raw" / "dir_bin");
+        uint32 spawnId = 1;
+
+        // tiled maps, M2 spawns of the same models all over them and a few WMOs crossing tile borders
+        for (uint32 mapId = 0; mapId < 3; ++mapId)
+        {
+            for (uint32 i = 0; i < 120; ++i)
+            {
+                VMAP::ModelSpawn spawn;
+                spawn.flags = VMAP::MOD_M2;
+                spawn.adtId = 0;
+                spawn.ID = spawnId++;
+                spawn.iPos = G3D::Vector3(position(rng), position(rng), position(rng) / 10.0f);
+                spawn.iRot = G3D::Vector3(angle(rng), angle(rng), angle(rng));
+                spawn.iScale = 0.5f + float(i % 4) * 0.25f;
+                spawn.name = "m2_" + std::to_string(rng() % 6) + ".m2";
+                WriteSpawn(dirBin, mapId, 30 + i % 4, 30 + i % 3, spawn);
+            }
+
+            for (uint32 i = 0; i < 8; ++i)
+            {
+                VMAP::ModelSpawn spawn;
+                spawn.flags = VMAP::MOD_HAS_BOUND;
+                spawn.adtId = 0;
+                spawn.ID = spawnId++;
+                spawn.iPos = G3D::Vector3(position(rng), position(rng), 0.0f);
+                spawn.iRot = G3D::Vector3(0.0f, angle(rng), 0.0f);
+                spawn.iScale = 1.0f;
+                spawn.iBound = G3D::AABox(spawn.iPos - G3D::Vector3(40.0f, 40.0f, 10.0f), spawn.iPos + G3D::Vector3(40.0f, 40.0f, 30.0f));
+                spawn.name = "wmo_" + std::to_string(i % 3) + ".wmo";
+
+                WriteSpawn(dirBin, mapId, 30 + i % 4, 30, spawn);
+                WriteSpawn(dirBin, mapId, 31 + i % 4, 31, spawn);
+            }
+        }
+
+        // instance map with a single global WMO
+        VMAP::ModelSpawn global;
+        global.flags = VMAP::MOD_WORLDSPAWN | VMAP::MOD_HAS_BOUND;
+        global.adtId = 0;
+        global.ID = spawnId++;
+        global.iPos = G3D::Vector3(10.0f, 20.0f, 30.0f);
+        global.iRot = G3D::Vector3::zero();
+        global.iScale = 1.0f;
+        global.iBound = G3D::AABox(G3D::Vector3(-100.0f, -100.0f, -50.0f), G3D::Vector3(100.0f, 100.0f, 50.0f));
+        global.name = "wmo_0.wmo";
+        WriteSpawn(dirBin, 33, 65, 65, global);
+    }
+
+    void TearDown() override
+    {
+        boost::system::error_code error;
+        fs::remove_all(_root, error);
+    }
+
+    std::map<std::string, std::string> Assemble(std::string const& name, uint32 threads)
+    {
+        fs::path dest = _root / name;
+        VMAP::TileAssembler assembler((_root / "raw").string(), dest.string(), threads);
+        EXPECT_TRUE(assembler.convertWorld2());
+        return ReadOutput(dest);
+    }
+
+    fs::path _root;
+};
+
+// cppcheck-suppress syntaxError
+TEST_F(TileAssemblerTest, ThreadedOutputMatchesSingleThread)
+{
+    auto single = Assemble("single", 1);
+    auto threaded = Assemble("threaded", 4);
+
+    EXPECT_EQ(single.count("000.vmtree"), 1u);
+    EXPECT_EQ(single.count("033.vmtree"), 1u);
+    EXPECT_EQ(single.count("000_30_30.vmtile"), 1u);
+    EXPECT_EQ(single.count("m2_0.m2.vmo"), 1u);
+    EXPECT_EQ(single.count("wmo_2.wmo.vmo"), 1u);
+
+    ASSERT_EQ(single.size(), threaded.size());
+    for (auto const& [name, content] : single)
+        EXPECT_TRUE(threaded[name] == content) << name;
+}
+
+TEST_F(TileAssemblerTest, SpawnBoundsUseTransformedModel)
+{
+    Assemble("bounds", 2);
+
+    // every M2 spawn of the tiles has its bound calculated from the shared model data
+    std::ifstream tile((_root / "bounds" / "000_30_30.vmtile").string(), std::ios::binary);
+    char magic[8];
+    uint32 spawns = 0;
+    tile.read(magic, 8);
+    tile.read(reinterpret_cast<char*>(&spawns), sizeof(spawns));
+    ASSERT_TRUE(tile.good());
+    EXPECT_EQ(std::string(magic, 8), std::string(VMAP::VMAP_MAGIC, 8));
+    EXPECT_GT(spawns, 0u);
+
+    uint32 flags = 0;
+    tile.read(reinterpret_cast<char*>(&flags), sizeof(flags));
+    EXPECT_TRUE(flags & VMAP::MOD_HAS_BOUND);
+}
+
+} // namespace
@@ -0,0 +1,112 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation; either version 2 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "TestPlayer.h"
+#include "MotionMaster.h"
+#include "ScriptMgr.h"
+#include "WorldSession.h"
+#include "ScriptDefines/MiscScript.h"
+#include "ScriptDefines/PlayerScript.h"
+#include "ScriptDefines/UnitScript.h"
+#include "ScriptDefines/WorldObjectScript.h"
+
+using namespace testing;
+
+TestPlayer::~TestPlayer()
+{
+    // PlaceOnMap skipped Player::AddToWorld, so skip Player::RemoveFromWorld as well
+    Object::RemoveFromWorld();
+}
+
+void TestPlayer::ForceInitValues(ObjectGuid::LowType guidLow)
+{
+    Object::_Create(guidLow, uint32(0), HighGuid::Player);
+    SetMaxHealth(100000);
+    SetHealth(100000);
+    ClearUpdateMask(false);
+}
+
+void TestPlayer::PlaceOnMap(Map* map)
+{
+    WorldObject::SetMap(map);
+    Relocate(0.0f, 0.0f, 0.0f);
+    Object::AddToWorld();
+    GetMotionMaster()->Initialize();
+}
+
+TestPlayer* TestPlayer::Create(ObjectGuid::LowType guidLow)
+{
+    WorldSession* session = new WorldSession(guidLow, "player" + std::to_string(guidLow), 0, nullptr, SEC_PLAYER,
+        EXPANSION_WRATH_OF_THE_LICH_KING, 0, LOCALE_enUS, 0, false, false, 0);
+
+    TestPlayer* player = new TestPlayer(session);
+    player->ForceInitValues(guidLow);
+    session->SetPlayer(player);
+    return player;
+}
+
+void TestPlayer::Destroy(TestPlayer* player)
+{
+    // detached first, the session would log the player out otherwise
+    WorldSession* session = player->GetSession();
+    session->SetPlayer(nullptr);
+
+    delete player;
+    delete session;
+}
+
+void TestPlayerFixture::SetUp()
+{
+    // hooks called by the constructors and destructors of players
+    ScriptRegistry<MiscScript>::InitEnabledHooksIfNeeded(MISCHOOK_END);
+    ScriptRegistry<WorldObjectScript>::InitEnabledHooksIfNeeded(WORLDOBJECTHOOK_END);
+    ScriptRegistry<UnitScript>::InitEnabledHooksIfNeeded(UNITHOOK_END);
+    ScriptRegistry<PlayerScript>::InitEnabledHooksIfNeeded(PLAYERHOOK_END);
+
+    originalWorld = sWorld.release();
+    worldMock = new NiceMock<WorldMock>();
+    sWorld.reset(worldMock);
+
+    static std::string emptyString;
+    ON_CALL(*worldMock, GetDataPath()).WillByDefault(ReturnRef(emptyString));
+    ON_CALL(*worldMock, GetRealmName()).WillByDefault(ReturnRef(emptyString));
+    ON_CALL(*worldMock, GetDefaultDbcLocale()).WillByDefault(Return(LOCALE_enUS));
+    ON_CALL(*worldMock, getRate(_)).WillByDefault(Return(1.0f));
+    ON_CALL(*worldMock, getBoolConfig(_)).WillByDefault(Return(false));
+    ON_CALL(*worldMock, getIntConfig(_)).WillByDefault(Return(0));
+    ON_CALL(*worldMock, getFloatConfig(_)).WillByDefault(Return(0.0f));
+    ON_CALL(*worldMock, GetPlayerSecurityLimit()).WillByDefault(Return(SEC_PLAYER));
+}
+
+void TestPlayerFixture::TearDown()
+{
+    for (TestPlayer* player : createdPlayers)
+        TestPlayer::Destroy(player);
+    createdPlayers.clear();
+
+    IWorld* currentWorld = sWorld.release();
+    delete currentWorld;
+    worldMock = nullptr;
+
+    sWorld.reset(originalWorld);
+    originalWorld = nullptr;
+}
+
+TestPlayer* TestPlayerFixture::CreatePlayer(ObjectGuid::LowType guidLow)
+{
+    TestPlayer* player = TestPlayer::Create(guidLow);
+    createdPlayers.push_back(player);
+    return player;
+}
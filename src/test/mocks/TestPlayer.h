@@ -0,0 +1,72 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation; either version 2 of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TEST_PLAYER_H
+#define TEST_PLAYER_H
+
+#include "ObjectGuid.h"
+#include "Player.h"
+#include "WorldMock.h"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+class Map;
+
+/**
+ * TestPlayer - A test harness for Player that bypasses database dependencies.
+ *
+ * Usage:
+ *   TestPlayer* player = TestPlayer::Create(1);  // guidLow, with a session of its own
+ *   player->PlaceOnMap(testMap);
+ *   TestPlayer::Destroy(player);                 // before testMap is deleted
+ */
+class TestPlayer : public Player
+{
+public:
+    using Player::Player;
+    ~TestPlayer() override;
+
+    void UpdateObjectVisibility(bool /*forced*/ = true, bool /*fromUpdate*/ = false) override { }
+
+    // Force initialization without database, at full health and with an empty update mask
+    void ForceInitValues(ObjectGuid::LowType guidLow);
+
+    // In world on the map, without the grid and session handling of Player::AddToWorld
+    void PlaceOnMap(Map* map);
+
+    // Player with a session of its own, free both with Destroy
+    static TestPlayer* Create(ObjectGuid::LowType guidLow);
+    static void Destroy(TestPlayer* player);
+};
+
+/**
+ * TestPlayerFixture - Replaces sWorld by a WorldMock for each test, with the defaults a
+ * TestPlayer needs: empty paths, no config enabled and rates of 1.
+ * Players made with CreatePlayer are destroyed in TearDown.
+ */
+class TestPlayerFixture : public ::testing::Test
+{
+protected:
+    void SetUp() override;
+    void TearDown() override;
+
+    TestPlayer* CreatePlayer(ObjectGuid::LowType guidLow);
+
+    IWorld* originalWorld = nullptr;
+    ::testing::NiceMock<WorldMock>* worldMock = nullptr;
+    std::vector<TestPlayer*> createdPlayers;
+};
+
+#endif // TEST_PLAYER_H
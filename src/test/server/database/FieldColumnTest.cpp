@@ -0,0 +1,376 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Column decoding of query results: Field::GetColumn and the batches used by
+ * FetchColumns/FetchRows must give the values Field::Get<T>() gives for every
+ * field, for ad hoc (text) and prepared (raw) rows alike.
+ */
+
+#include "QueryResult.h"
+#include "gtest/gtest.h"
+#include <chrono>
+#include <deque>
+#include <iostream>
+#include <string>
+#include <string_view>
+
+namespace
+{
+
+class TestField : public Field
+{
+public:
+    using Field::SetByteValue;
+    using Field::SetMetadata;
+    using Field::SetStructuredValue;
+};
+
+static_assert(sizeof(TestField) == sizeof(Field));
+
+// rows of fields pointing into values owned by the table, like a stored mysql result
+class TestTable
+{
+public:
+    explicit TestTable(std::vector<QueryResultFieldMetadata> columns) : _columns(std::move(columns))
+    {
+        for (uint32 i = 0; i < _columns.size(); ++i)
+            _columns[i].Index = i;
+    }
+
+    void AddTextRow(std::vector<char const*> const& values)
+    {
+        for (std::size_t i = 0; i < values.size(); ++i)
+        {
+            TestField& field = NextField(i);
+            if (!values[i])
+                field.SetStructuredValue(nullptr, 0);
+            else
+            {
+                std::string const& value = _values.emplace_back(values[i]);
+                field.SetStructuredValue(value.data(), value.size());
+            }
+        }
+    }
+
+    template<typename... Ts>
+    void AddRawRow(Ts... values)
+    {
+        std::size_t column = 0;
+        (AddRawValue(NextField(column++), values), ...);
+    }
+
+    void AddRawNull(std::size_t column)
+    {
+        NextField(column).SetByteValue(nullptr, 0);
+    }
+
+    Field const* GetRows() const { return _fields.data(); }
+    std::size_t GetFieldCount() const { return _columns.size(); }
+    std::size_t GetRowCount() const { return _fields.size() / _columns.size(); }
+
+    template<typename T>
+    void ExpectColumnMatchesGet(std::size_t column) const
+    {
+        auto decoded = std::make_unique<T[]>(GetRowCount());
+        Field::GetColumn(GetRows() + column, GetFieldCount(), GetRowCount(), decoded.get());
+
+        for (std::size_t row = 0; row < GetRowCount(); ++row)
+            EXPECT_EQ(decoded[row], _fields[row * GetFieldCount() + column].Get<T>()) << "column " << column << " row " << row;
+    }
+
+private:
+    TestField& NextField(std::size_t column)
+    {
+        TestField& field = _fields.emplace_back();
+        field.SetMetadata(&_columns[column]);
+        return field;
+    }
+
+    template<typename T>
+    void AddRawValue(TestField& field, T value)
+    {
+        std::string const& bytes = _values.emplace_back(reinterpret_cast<char const*>(&value), sizeof(T));
+        field.SetByteValue(bytes.data(), bytes.size());
+    }
+
+    void AddRawValue(TestField& field, char const* value)
+    {
+        std::string const& bytes = _values.emplace_back(value);
+        field.SetByteValue(bytes.data(), bytes.size());
+    }
+
+    std::vector<QueryResultFieldMetadata> _columns;
+    std::vector<TestField> _fields;
+    std::deque<std::string> _values;
+};
+
+QueryResultFieldMetadata Column(DatabaseFieldTypes type, std::string alias = "", std::string table = "creature_loot_template")
+{
+    QueryResultFieldMetadata meta;
+    meta.TableName = table;
+    meta.TableAlias = table;
+    meta.Name = alias.empty() ? "value" : alias;
+    meta.Alias = meta.Name;
+    meta.TypeName = "TEST";
+    meta.Type = type;
+    return meta;
+}
+
+std::vector<QueryResultFieldMetadata> LootColumns()
+{
+    return { Column(DatabaseFieldTypes::Int32), Column(DatabaseFieldTypes::Int32), Column(DatabaseFieldTypes::Int32),
+        Column(DatabaseFieldTypes::Float), Column(DatabaseFieldTypes::Int8), Column(DatabaseFieldTypes::Int16),
+        Column(DatabaseFieldTypes::Int8), Column(DatabaseFieldTypes::Int8), Column(DatabaseFieldTypes::Int8) };
+}
+
+struct LootRow
+{
+    uint32 Entry;
+    uint32 Item;
+    int32 Reference;
+    float Chance;
+    bool QuestRequired;
+    uint16 LootMode;
+    uint8 GroupId;
+    uint8 MinCount;
+    uint8 MaxCount;
+};
+
+void AddLootRow(TestTable& table, uint32 row)
+{
+    std::string const entry = std::to_string(1000 + row / 7);
+    std::string const item = std::to_string(20000 + row % 5000);
+    std::string const reference = std::to_string(row % 11 == 0 ? -int32(row % 300) : 0);
+    std::string const chance = std::to_string(float(row % 1000) / 10.0f);
+    std::string const counts = std::to_string(1 + row % 3);
+    table.AddTextRow({ entry.c_str(), item.c_str(), reference.c_str(), chance.c_str(), row % 2 ? "1" : "0", "1",
+        row % 4 ? "0" : "2", counts.c_str(), counts.c_str() });
+}
+
+}
+
+TEST(FieldColumnTest, TextColumnsMatchGet)
+{
+    TestTable table({ Column(DatabaseFieldTypes::Int32), Column(DatabaseFieldTypes::Int32), Column(DatabaseFieldTypes::Float),
+        Column(DatabaseFieldTypes::Decimal), Column(DatabaseFieldTypes::Int8), Column(DatabaseFieldTypes::Int64),
+        Column(DatabaseFieldTypes::Binary) });
+
+    table.AddTextRow({ "1", "-5", "1.5", "10.25", "1", "18446744073709551615", "first" });
+    table.AddTextRow({ "4294967295", "2147483647", "-0.25", "3", "0", "0", "" });
+    table.AddTextRow({ nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr });
+    table.AddTextRow({ "7", "0", "100", "0.5", "1", "42", "last" });
+
+    table.ExpectColumnMatchesGet<uint32>(0);
+    table.ExpectColumnMatchesGet<int32>(1);
+    table.ExpectColumnMatchesGet<float>(2);
+    table.ExpectColumnMatchesGet<double>(3);
+    table.ExpectColumnMatchesGet<bool>(4);
+    table.ExpectColumnMatchesGet<uint64>(5);
+    table.ExpectColumnMatchesGet<std::string>(6);
+    table.ExpectColumnMatchesGet<std::string_view>(6);
+    table.ExpectColumnMatchesGet<Binary>(6);
+}
+
+TEST(FieldColumnTest, RawColumnsMatchGet)
+{
+    TestTable table({ Column(DatabaseFieldTypes::Int32), Column(DatabaseFieldTypes::Int16), Column(DatabaseFieldTypes::Float),
+        Column(DatabaseFieldTypes::Double), Column(DatabaseFieldTypes::Decimal), Column(DatabaseFieldTypes::Binary) });
+
+    table.AddRawRow(uint32(1), uint16(65535), 1.5f, 2.25, "10.5", "first");
+    table.AddRawRow(uint32(4294967295), uint16(0), -3.0f, -0.125, "0", "second");
+    for (std::size_t column = 0; column < table.GetFieldCount(); ++column)
+        table.AddRawNull(column);
+
+    table.ExpectColumnMatchesGet<uint32>(0);
+    table.ExpectColumnMatchesGet<uint16>(1);
+    table.ExpectColumnMatchesGet<float>(2);
+    table.ExpectColumnMatchesGet<double>(3);
+    table.ExpectColumnMatchesGet<double>(4);
+    table.ExpectColumnMatchesGet<std::string>(5);
+}
+
+TEST(FieldColumnTest, ColumnsCheckedPerFieldMatchGet)
+{
+    // aggregate aliases and -1 in *_dbc tables are handled by Get<T>() for every field
+    TestTable table({ Column(DatabaseFieldTypes::Int64, "count(*)"), Column(DatabaseFieldTypes::Decimal, "sum(value)"),
+        Column(DatabaseFieldTypes::Int32, "", "spell_dbc") });
+
+    table.AddTextRow({ "12", "1.5", "-1" });
+    table.AddTextRow({ "0", "2", "4294967295" });
+
+    table.ExpectColumnMatchesGet<uint64>(0);
+    table.ExpectColumnMatchesGet<double>(1);
+    table.ExpectColumnMatchesGet<uint32>(2);
+}
+
+TEST(FieldColumnTest, BatchFillsRowsAndColumns)
+{
+    TestTable table(LootColumns());
+    for (uint32 row = 0; row < 40; ++row)
+        AddLootRow(table, row);
+
+    ResultColumnBatch<uint32, uint32, int32, float, bool, uint16, uint8, uint8, uint8> batch;
+    batch.Decode(table.GetRows(), table.GetFieldCount(), table.GetRowCount());
+
+    std::vector<LootRow> rows;
+    batch.AppendTo(rows, std::make_tuple(&LootRow::Entry, &LootRow::Item, &LootRow::Reference, &LootRow::Chance,
+        &LootRow::QuestRequired, &LootRow::LootMode, &LootRow::GroupId, &LootRow::MinCount, &LootRow::MaxCount));
+
+    std::tuple<std::vector<uint32>, std::vector<uint32>, std::vector<int32>, std::vector<float>, std::vector<bool>,
+        std::vector<uint16>, std::vector<uint8>, std::vector<uint8>, std::vector<uint8>> columns;
+    batch.AppendTo(columns);
+
+    ASSERT_EQ(rows.size(), table.GetRowCount());
+    ASSERT_EQ(std::get<4>(columns).size(), table.GetRowCount());
+
+    for (std::size_t i = 0; i < rows.size(); ++i)
+    {
+        Field const* fields = table.GetRows() + i * table.GetFieldCount();
+        EXPECT_EQ(rows[i].Entry, fields[0].Get<uint32>());
+        EXPECT_EQ(rows[i].Item, fields[1].Get<uint32>());
+        EXPECT_EQ(rows[i].Reference, fields[2].Get<int32>());
+        EXPECT_EQ(rows[i].Chance, fields[3].Get<float>());
+        EXPECT_EQ(rows[i].QuestRequired, fields[4].Get<bool>());
+        EXPECT_EQ(rows[i].LootMode, fields[5].Get<uint16>());
+        EXPECT_EQ(rows[i].GroupId, fields[6].Get<uint8>());
+        EXPECT_EQ(rows[i].MinCount, fields[7].Get<uint8>());
+        EXPECT_EQ(rows[i].MaxCount, fields[8].Get<uint8>());
+
+        EXPECT_EQ(std::get<0>(columns)[i], rows[i].Entry);
+        EXPECT_EQ(std::get<3>(columns)[i], rows[i].Chance);
+        EXPECT_EQ(std::get<4>(columns)[i], rows[i].QuestRequired);
+    }
+}
+
+namespace
+{
+
+// text rows read through ResultSet like a stored mysql result, freeing the result overwrites them
+class TestResultSet : public ResultSet
+{
+public:
+    TestResultSet(std::vector<QueryResultFieldMetadata> columns, std::vector<std::vector<std::string>> rows) :
+        ResultSet(std::move(columns), rows.size()), _rows(std::move(rows))
+    {
+        NextRow();
+    }
+
+    bool Freed = false;
+
+protected:
+    bool ReadRow(char**& values, unsigned long*& lengths) override
+    {
+        if (Freed || _nextRow == _rows.size())
+            return false;
+
+        std::vector<std::string>& row = _rows[_nextRow++];
+        _values.clear();
+        _lengths.clear();
+        for (std::string& value : row)
+        {
+            _values.push_back(value.data());
+            _lengths.push_back(value.size());
+        }
+
+        values = _values.data();
+        lengths = _lengths.data();
+        return true;
+    }
+
+    void FreeResult() override
+    {
+        for (std::vector<std::string>& row : _rows)
+            for (std::string& value : row)
+                std::fill(value.begin(), value.end(), '#');
+
+        Freed = true;
+    }
+
+private:
+    std::vector<std::vector<std::string>> _rows;
+    std::size_t _nextRow = 0;
+    std::vector<char*> _values;
+    std::vector<unsigned long> _lengths;
+};
+
+struct NameRow
+{
+    uint32 Entry;
+    std::string_view Name;
+};
+
+}
+
+TEST(FieldColumnTest, StringViewRowsOutliveTheFetch)
+{
+    std::vector<std::vector<std::string>> values;
+    for (uint32 row = 0; row < 300; ++row)                  // more than one batch
+        values.push_back({ std::to_string(row), "creature " + std::to_string(row) });
+
+    TestResultSet result({ Column(DatabaseFieldTypes::Int32), Column(DatabaseFieldTypes::Binary, "name") }, values);
+    std::vector<NameRow> rows = result.FetchRows<NameRow>(&NameRow::Entry, &NameRow::Name);
+
+    EXPECT_FALSE(result.Freed);
+    ASSERT_EQ(rows.size(), values.size());
+    for (uint32 row = 0; row < rows.size(); ++row)
+    {
+        EXPECT_EQ(rows[row].Entry, row);
+        EXPECT_EQ(rows[row].Name, values[row][1]);
+    }
+}
+
+// run with --gtest_also_run_disabled_tests
+TEST(FieldColumnTest, DISABLED_BenchmarkLootTable)
+{
+    static constexpr uint32 Rows = 2000000;
+
+    TestTable table(LootColumns());
+    for (uint32 row = 0; row < Rows; ++row)
+        AddLootRow(table, row);
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<LootRow> perField;
+    perField.reserve(Rows);
+    for (std::size_t i = 0; i < Rows; ++i)
+    {
+        Field const* fields = table.GetRows() + i * table.GetFieldCount();
+        perField.push_back({ fields[0].Get<uint32>(), fields[1].Get<uint32>(), fields[2].Get<int32>(), fields[3].Get<float>(),
+            fields[4].Get<bool>(), fields[5].Get<uint16>(), fields[6].Get<uint8>(), fields[7].Get<uint8>(), fields[8].Get<uint8>() });
+    }
+    auto perFieldTime = std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+    using Batch = ResultColumnBatch<uint32, uint32, int32, float, bool, uint16, uint8, uint8, uint8>;
+    auto batch = std::make_unique<Batch>();
+    auto const schema = std::make_tuple(&LootRow::Entry, &LootRow::Item, &LootRow::Reference, &LootRow::Chance,
+        &LootRow::QuestRequired, &LootRow::LootMode, &LootRow::GroupId, &LootRow::MinCount, &LootRow::MaxCount);
+    std::vector<LootRow> batched;
+    batched.reserve(Rows);
+    for (std::size_t row = 0; row < Rows; row += Batch::MaxRows)
+    {
+        batch->Decode(table.GetRows() + row * table.GetFieldCount(), table.GetFieldCount(), std::min<std::size_t>(Batch::MaxRows, Rows - row));
+        batch->AppendTo(batched, schema);
+    }
+    auto batchedTime = std::chrono::steady_clock::now() - start;
+
+    ASSERT_EQ(batched.size(), perField.size());
+    EXPECT_EQ(batched.back().Item, perField.back().Item);
+
+    std::cout << Rows << " rows: Get<T>() per field " << std::chrono::duration_cast<std::chrono::milliseconds>(perFieldTime).count()
+        << " ms, column batches " << std::chrono::duration_cast<std::chrono::milliseconds>(batchedTime).count() << " ms" << std::endl;
+}
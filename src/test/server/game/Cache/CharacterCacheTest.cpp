@@ -0,0 +1,103 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Character cache lookups by guid and by name through the open addressing
+ * indexes, across renames, deletions and index growth.
+ */
+
+#include "CharacterCache.h"
+#include "gtest/gtest.h"
+
+namespace
+{
+
+// the cache is a singleton, every test uses its own guid range
+ObjectGuid MakeGuid(ObjectGuid::LowType low)
+{
+    return ObjectGuid::Create<HighGuid::Player>(low);
+}
+
+// cppcheck-suppress syntaxError
+TEST(CharacterCacheTest, LookupByGuidAndName)
+{
+    sCharacterCache->AddCharacterCacheEntry(MakeGuid(100), 7, "Arthas", GENDER_MALE, RACE_HUMAN, CLASS_PALADIN, 80);
+
+    CharacterCacheEntry const* byGuid = sCharacterCache->GetCharacterCacheByGuid(MakeGuid(100));
+    ASSERT_NE(byGuid, nullptr);
+    EXPECT_EQ(byGuid->Name, "Arthas");
+    EXPECT_EQ(byGuid->AccountId, 7u);
+    EXPECT_EQ(byGuid->Level, 80);
+
+    EXPECT_EQ(sCharacterCache->GetCharacterCacheByName("Arthas"), byGuid);
+    EXPECT_EQ(sCharacterCache->GetCharacterGuidByName("Arthas"), MakeGuid(100));
+    EXPECT_EQ(sCharacterCache->GetCharacterAccountIdByName("Arthas"), 7u);
+    EXPECT_EQ(sCharacterCache->GetCharacterGuidByName("Uther"), ObjectGuid::Empty);
+    EXPECT_FALSE(sCharacterCache->HasCharacterCacheEntry(MakeGuid(101)));
+}
+
+TEST(CharacterCacheTest, RenameMovesNameIndex)
+{
+    sCharacterCache->AddCharacterCacheEntry(MakeGuid(200), 1, "Jaina", GENDER_FEMALE, RACE_HUMAN, CLASS_MAGE, 80);
+    sCharacterCache->UpdateCharacterData(MakeGuid(200), "Proudmoore");
+
+    EXPECT_EQ(sCharacterCache->GetCharacterGuidByName("Jaina"), ObjectGuid::Empty);
+    EXPECT_EQ(sCharacterCache->GetCharacterGuidByName("Proudmoore"), MakeGuid(200));
+
+    std::string name;
+    EXPECT_TRUE(sCharacterCache->GetCharacterNameByGuid(MakeGuid(200), name));
+    EXPECT_EQ(name, "Proudmoore");
+}
+
+TEST(CharacterCacheTest, DeleteRemovesBothIndexes)
+{
+    sCharacterCache->AddCharacterCacheEntry(MakeGuid(300), 1, "Thrall", GENDER_MALE, RACE_ORC, CLASS_SHAMAN, 80);
+    sCharacterCache->IncreaseCharacterMailCount(MakeGuid(300));
+    sCharacterCache->DeleteCharacterCacheEntry(MakeGuid(300), "Thrall");
+
+    EXPECT_FALSE(sCharacterCache->HasCharacterCacheEntry(MakeGuid(300)));
+    EXPECT_EQ(sCharacterCache->GetCharacterCacheByName("Thrall"), nullptr);
+
+    // the freed entry is reused without keeping the previous character's data
+    sCharacterCache->AddCharacterCacheEntry(MakeGuid(301), 2, "Garrosh", GENDER_MALE, RACE_ORC, CLASS_WARRIOR, 80);
+    CharacterCacheEntry const* data = sCharacterCache->GetCharacterCacheByGuid(MakeGuid(301));
+    ASSERT_NE(data, nullptr);
+    EXPECT_EQ(data->MailCount, 0);
+    EXPECT_EQ(sCharacterCache->GetCharacterGuidByName("Garrosh"), MakeGuid(301));
+}
+
+TEST(CharacterCacheTest, ManyEntriesSurviveGrowthAndDeletion)
+{
+    constexpr ObjectGuid::LowType First = 10000;
+    constexpr ObjectGuid::LowType Count = 5000;
+
+    for (ObjectGuid::LowType i = First; i < First + Count; ++i)
+        sCharacterCache->AddCharacterCacheEntry(MakeGuid(i), i, "Char" + std::to_string(i), GENDER_MALE, RACE_HUMAN, CLASS_WARRIOR, 1);
+
+    // every other one removed, the remaining keys must still be reachable after the slots shifted
+    for (ObjectGuid::LowType i = First; i < First + Count; i += 2)
+        sCharacterCache->DeleteCharacterCacheEntry(MakeGuid(i), "Char" + std::to_string(i));
+
+    for (ObjectGuid::LowType i = First; i < First + Count; ++i)
+    {
+        bool deleted = (i - First) % 2 == 0;
+        EXPECT_EQ(sCharacterCache->HasCharacterCacheEntry(MakeGuid(i)), !deleted) << i;
+        EXPECT_EQ(sCharacterCache->GetCharacterAccountIdByName("Char" + std::to_string(i)), deleted ? 0u : i) << i;
+    }
+}
+
+} // namespace
@@ -0,0 +1,239 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Login queries are only warmed up for characters that relog quickly, a relog during
+ * the warm-up takes over the pending load, and cached queries are never served after
+ * an offline update of the character or a login on the same account.
+ */
+
+#include "PlayerLoginCache.h"
+#include "WorldMock.h"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include <future>
+#include <list>
+
+using namespace testing;
+
+class PlayerLoginCacheTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        originalWorld = sWorld.release();
+        worldMock = new NiceMock<WorldMock>();
+        sWorld.reset(worldMock);
+
+        ON_CALL(*worldMock, getBoolConfig(CONFIG_PLAYER_LOGIN_CACHE_ENABLED)).WillByDefault(Return(true));
+        ON_CALL(*worldMock, getIntConfig(CONFIG_PLAYER_LOGIN_CACHE_DURATION)).WillByDefault(Return(300));
+        ON_CALL(*worldMock, getIntConfig(CONFIG_PLAYER_LOGIN_CACHE_MAX_ENTRIES)).WillByDefault(Return(100));
+    }
+
+    void TearDown() override
+    {
+        // the remaining logout saves "fail", which drops whatever the tests left in the cache
+        for (Save& save : _saves)
+            if (!save.Done)
+                save.Result.set_value(false);
+
+        sPlayerLoginCache->Update();
+        sPlayerLoginCache->InvalidateAll();
+
+        IWorld* currentWorld = sWorld.release();
+        delete currentWorld;
+        sWorld.reset(originalWorld);
+    }
+
+    // logs out once and relogs right away, so that the next logout is warmed up
+    void RelogQuickly(ObjectGuid guid, uint32 accountId = AccountId)
+    {
+        EXPECT_FALSE(sPlayerLoginCache->RecordLogout(guid));
+        EXPECT_FALSE(sPlayerLoginCache->Take(guid, accountId));
+    }
+
+    // logs out with a logout save that is queued but not committed yet
+    void Logout(ObjectGuid guid, uint32 accountId = AccountId)
+    {
+        ASSERT_TRUE(sPlayerLoginCache->RecordLogout(guid));
+
+        _saves.emplace_back();
+        sPlayerLoginCache->AddLogoutSave(guid, accountId, TransactionCallback(_saves.back().Result.get_future()), [this]()
+        {
+            std::shared_ptr<CharacterDatabaseQueryHolder> holder = std::make_shared<CharacterDatabaseQueryHolder>();
+            _loads.emplace_back();
+            lastLoaded = holder;
+            return SQLQueryHolderCallback(holder, _loads.back().get_future());
+        });
+    }
+
+    void CommitLogoutSave()
+    {
+        _saves.back().Result.set_value(true);
+        _saves.back().Done = true;
+        sPlayerLoginCache->Update();
+    }
+
+    void FinishLoad()
+    {
+        _loads.back().set_value();
+        sPlayerLoginCache->Update();
+    }
+
+    static bool IsReady(SQLQueryHolderCallback& query)
+    {
+        return query.m_future.wait_for(0s) == std::future_status::ready;
+    }
+
+    static ObjectGuid MakeGuid(ObjectGuid::LowType low)
+    {
+        return ObjectGuid::Create<HighGuid::Player>(low);
+    }
+
+    static constexpr uint32 AccountId = 5;
+
+    IWorld* originalWorld = nullptr;
+    NiceMock<WorldMock>* worldMock = nullptr;
+    std::shared_ptr<SQLQueryHolderBase> lastLoaded;
+
+private:
+    struct Save
+    {
+        std::promise<bool> Result;
+        bool Done = false;
+    };
+
+    std::list<Save> _saves;
+    std::list<QueryResultHolderPromise> _loads;
+};
+
+TEST_F(PlayerLoginCacheTest, FirstLogoutIsNotWarmedUp)
+{
+    EXPECT_FALSE(sPlayerLoginCache->RecordLogout(MakeGuid(1)));
+    EXPECT_FALSE(sPlayerLoginCache->Take(MakeGuid(1), AccountId));
+}
+
+TEST_F(PlayerLoginCacheTest, QuickRelogIsServedFromCache)
+{
+    RelogQuickly(MakeGuid(2));
+    Logout(MakeGuid(2));
+    CommitLogoutSave();
+    FinishLoad();
+
+    std::optional<SQLQueryHolderCallback> query = sPlayerLoginCache->Take(MakeGuid(2), AccountId);
+    ASSERT_TRUE(query);
+    EXPECT_EQ(query->m_holder, lastLoaded);
+    EXPECT_TRUE(IsReady(*query));
+
+    // a login consumes the entry
+    EXPECT_FALSE(sPlayerLoginCache->Take(MakeGuid(2), AccountId));
+}
+
+TEST_F(PlayerLoginCacheTest, RelogWhileLoadingTakesOverTheLoad)
+{
+    RelogQuickly(MakeGuid(3));
+    Logout(MakeGuid(3));
+    CommitLogoutSave();
+
+    std::optional<SQLQueryHolderCallback> query = sPlayerLoginCache->Take(MakeGuid(3), AccountId);
+    ASSERT_TRUE(query);
+    EXPECT_EQ(query->m_holder, lastLoaded);
+    EXPECT_FALSE(IsReady(*query));
+
+    FinishLoad();
+    EXPECT_TRUE(IsReady(*query));
+}
+
+TEST_F(PlayerLoginCacheTest, RelogBeforeSaveIsLoadedFromDatabase)
+{
+    RelogQuickly(MakeGuid(4));
+    Logout(MakeGuid(4));
+
+    EXPECT_FALSE(sPlayerLoginCache->Take(MakeGuid(4), AccountId));
+
+    // the save completing afterwards does not start a load
+    lastLoaded.reset();
+    CommitLogoutSave();
+    EXPECT_EQ(lastLoaded, nullptr);
+}
+
+TEST_F(PlayerLoginCacheTest, OfflineUpdateIsNotServed)
+{
+    RelogQuickly(MakeGuid(5));
+    Logout(MakeGuid(5));
+    CommitLogoutSave();
+    FinishLoad();
+
+    // e.g. AchievementGlobalMgr::CompletedAchievementForOfflinePlayer
+    sPlayerLoginCache->Invalidate(MakeGuid(5));
+
+    EXPECT_FALSE(sPlayerLoginCache->Take(MakeGuid(5), AccountId));
+}
+
+TEST_F(PlayerLoginCacheTest, OfflineUpdateWhileLoadingIsNotServed)
+{
+    RelogQuickly(MakeGuid(6));
+    Logout(MakeGuid(6));
+    CommitLogoutSave();
+
+    // the results may predate the update, they must not be kept
+    sPlayerLoginCache->Invalidate(MakeGuid(6));
+    FinishLoad();
+
+    EXPECT_FALSE(sPlayerLoginCache->Take(MakeGuid(6), AccountId));
+}
+
+TEST_F(PlayerLoginCacheTest, ResetOfAllCharactersIsNotServed)
+{
+    RelogQuickly(MakeGuid(7));
+    RelogQuickly(MakeGuid(8), AccountId + 1);
+    Logout(MakeGuid(7));
+    CommitLogoutSave();
+    FinishLoad();
+    Logout(MakeGuid(8), AccountId + 1);
+    CommitLogoutSave();
+
+    // e.g. World::ResetDailyQuests
+    sPlayerLoginCache->InvalidateAll();
+    FinishLoad();
+
+    EXPECT_FALSE(sPlayerLoginCache->Take(MakeGuid(7), AccountId));
+    EXPECT_FALSE(sPlayerLoginCache->Take(MakeGuid(8), AccountId + 1));
+}
+
+TEST_F(PlayerLoginCacheTest, LoginOnSameAccountDropsOtherCharacters)
+{
+    RelogQuickly(MakeGuid(9));
+    Logout(MakeGuid(9));
+    CommitLogoutSave();
+    FinishLoad();
+
+    // another character of the account plays and may change the instance lock times
+    sPlayerLoginCache->Take(MakeGuid(10), AccountId);
+
+    EXPECT_FALSE(sPlayerLoginCache->Take(MakeGuid(9), AccountId));
+}
+
+TEST_F(PlayerLoginCacheTest, OtherAccountIsNotServed)
+{
+    RelogQuickly(MakeGuid(11));
+    Logout(MakeGuid(11));
+    CommitLogoutSave();
+    FinishLoad();
+
+    EXPECT_FALSE(sPlayerLoginCache->Take(MakeGuid(11), AccountId + 1));
+}
@@ -0,0 +1,110 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Who list level and zone buckets across inserts, refreshed entries and
+ * removals, including the swap with the last entry of a bucket.
+ */
+
+#include "WhoListCacheMgr.h"
+#include "gtest/gtest.h"
+#include <set>
+
+namespace
+{
+
+ObjectGuid MakeGuid(ObjectGuid::LowType low)
+{
+    return ObjectGuid::Create<HighGuid::Player>(low);
+}
+
+WhoListPlayerInfo MakeInfo(ObjectGuid::LowType low, uint8 level, uint32 zoneId)
+{
+    return WhoListPlayerInfo(MakeGuid(low), TEAM_ALLIANCE, SEC_PLAYER, level, CLASS_WARRIOR, RACE_HUMAN, zoneId, GENDER_MALE, true,
+        L"player", L"", "Player", "");
+}
+
+std::set<ObjectGuid::LowType> Visit(WhoListIndex const& index, uint32 levelMin, uint32 levelMax, std::vector<uint32> zones = {})
+{
+    std::set<ObjectGuid::LowType> found;
+    index.VisitPlayers(levelMin, levelMax, std::move(zones), [&](WhoListPlayerInfo const& info)
+    {
+        EXPECT_TRUE(found.insert(info.GetGuid().GetCounter()).second);
+    });
+    return found;
+}
+
+// cppcheck-suppress syntaxError
+TEST(WhoListIndexTest, InsertFillsLevelAndZoneBuckets)
+{
+    WhoListIndex index;
+    index.Add(MakeInfo(1, 10, 12));
+    index.Add(MakeInfo(2, 10, 1519));
+    index.Add(MakeInfo(3, 80, 12));
+
+    EXPECT_EQ(index.GetSize(), 3u);
+    EXPECT_EQ(Visit(index, 10, 10), (std::set<ObjectGuid::LowType>{ 1, 2 }));
+    EXPECT_EQ(Visit(index, 1, 80), (std::set<ObjectGuid::LowType>{ 1, 2, 3 }));
+    EXPECT_EQ(Visit(index, 1, 80, { 12 }), (std::set<ObjectGuid::LowType>{ 1, 3 }));
+    EXPECT_EQ(Visit(index, 20, 80, { 12, 12 }), (std::set<ObjectGuid::LowType>{ 3 }));
+    EXPECT_TRUE(Visit(index, 1, 80, { 141 }).empty());
+}
+
+TEST(WhoListIndexTest, UpdateMovesTheEntryBetweenBuckets)
+{
+    WhoListIndex index;
+    index.Add(MakeInfo(1, 10, 12));
+    index.Add(MakeInfo(2, 10, 12));
+    index.Add(MakeInfo(3, 10, 12));
+
+    // level up and zone change of the first entry, the last entry takes its slot in both buckets
+    index.Add(MakeInfo(1, 11, 1519));
+
+    EXPECT_EQ(index.GetSize(), 3u);
+    EXPECT_EQ(Visit(index, 10, 10), (std::set<ObjectGuid::LowType>{ 2, 3 }));
+    EXPECT_EQ(Visit(index, 11, 11), (std::set<ObjectGuid::LowType>{ 1 }));
+    EXPECT_EQ(Visit(index, 1, 80, { 12 }), (std::set<ObjectGuid::LowType>{ 2, 3 }));
+    EXPECT_EQ(Visit(index, 1, 80, { 1519 }), (std::set<ObjectGuid::LowType>{ 1 }));
+
+    // the moved entry kept a valid slot, removing it leaves the others in place
+    index.Remove(MakeGuid(3));
+    EXPECT_EQ(Visit(index, 10, 10), (std::set<ObjectGuid::LowType>{ 2 }));
+    EXPECT_EQ(Visit(index, 1, 80, { 12 }), (std::set<ObjectGuid::LowType>{ 2 }));
+}
+
+TEST(WhoListIndexTest, RemoveEmptiesTheBuckets)
+{
+    WhoListIndex index;
+    index.Add(MakeInfo(1, 10, 12));
+    index.Add(MakeInfo(2, 80, 12));
+
+    index.Remove(MakeGuid(1));
+    index.Remove(MakeGuid(1));
+    EXPECT_EQ(index.GetSize(), 1u);
+    EXPECT_EQ(Visit(index, 1, 80), (std::set<ObjectGuid::LowType>{ 2 }));
+
+    index.Remove(MakeGuid(2));
+    EXPECT_EQ(index.GetSize(), 0u);
+    EXPECT_TRUE(Visit(index, 1, 80).empty());
+    EXPECT_TRUE(Visit(index, 1, 80, { 12 }).empty());
+
+    // the level range is clamped to the buckets that exist
+    index.Add(MakeInfo(3, 80, 12));
+    EXPECT_EQ(Visit(index, 70, 255), (std::set<ObjectGuid::LowType>{ 3 }));
+}
+
+} // namespace
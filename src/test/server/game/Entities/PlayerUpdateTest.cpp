@@ -0,0 +1,121 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Player housekeeping counted in game time seconds runs once per second
+ * instead of every update, and what idle players cost per update.
+ */
+
+#include "GameTime.h"
+#include "MotionMaster.h"
+#include "MovementGenerator.h"
+#include "Player.h"
+#include "TestMap.h"
+#include "TestPlayer.h"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include <chrono>
+#include <iostream>
+
+using namespace testing;
+
+namespace
+{
+
+class PlayerUpdateTest : public TestPlayerFixture
+{
+protected:
+    void SetUp() override
+    {
+        TestPlayerFixture::SetUp();
+
+        TestMap::EnsureDBC();
+
+        if (!sMovementGeneratorRegistry->GetRegistryItem(IDLE_MOTION_TYPE))
+            (new IdleMovementFactory())->RegisterSelf();
+    }
+
+    void TearDown() override
+    {
+        // the players are taken off the map first
+        TestPlayerFixture::TearDown();
+
+        delete map;
+        map = nullptr;
+    }
+
+    TestMap* map = nullptr;
+};
+
+// cppcheck-suppress syntaxError
+TEST_F(PlayerUpdateTest, SecondTimersCountElapsedSeconds)
+{
+    TestPlayer* player = CreatePlayer(1);
+    player->m_Last_tick = 1000;
+    uint32 played = player->GetTotalPlayedTime();
+
+    player->UpdateSecondTimers(1003);
+
+    EXPECT_EQ(player->GetTotalPlayedTime(), played + 3);
+    EXPECT_EQ(player->GetLevelPlayedTime(), 3u);
+    EXPECT_EQ(player->m_Last_tick, 1003);
+}
+
+TEST_F(PlayerUpdateTest, SecondTimersExpireInstanceEnterTimes)
+{
+    TestPlayer* player = CreatePlayer(1);
+    player->m_Last_tick = 1000;
+    player->AddInstanceEnterTime(7, 1000);
+
+    player->UpdateSecondTimers(1000 + HOUR);
+    EXPECT_TRUE(player->CheckInstanceCount(7));
+
+    player->UpdateSecondTimers(1001 + HOUR);
+    EXPECT_FALSE(player->CheckInstanceCount(7));
+}
+
+TEST_F(PlayerUpdateTest, DISABLED_BenchmarkIdlePlayers)
+{
+    static constexpr uint32 PlayerCount = 2000;
+    static constexpr uint32 Ticks = 500;
+    static constexpr uint32 TickDiff = 50;
+
+    map = new TestMap();
+
+    std::vector<TestPlayer*> players;
+    for (uint32 i = 0; i < PlayerCount; ++i)
+    {
+        TestPlayer* player = CreatePlayer(i + 1);
+        player->PlaceOnMap(map);
+        players.push_back(player);
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    for (uint32 tick = 0; tick < Ticks; ++tick)
+    {
+        GameTime::UpdateGameTimers();
+
+        for (TestPlayer* player : players)
+            player->Update(TickDiff);
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    std::cout << PlayerCount << " idle players, " << Ticks << " updates: "
+        << std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count() / Ticks << " us per update" << std::endl;
+}
+
+} // namespace
@@ -0,0 +1,74 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "UpdateFieldFlags.h"
+#include "UpdateMask.h"
+#include "gtest/gtest.h"
+#include <vector>
+
+namespace
+{
+
+// cppcheck-suppress syntaxError
+TEST(UpdateMaskTest, BitsMatchClientLayout)
+{
+    UpdateMask mask;
+    mask.SetCount(70);
+    mask.SetBit(0);
+    mask.SetBit(31);
+    mask.SetBit(32);
+    mask.SetBit(69);
+    mask.SetBit(40);
+    mask.UnsetBit(40);
+
+    EXPECT_EQ(mask.GetBlockCount(), 3u);
+    EXPECT_TRUE(mask.GetBit(31));
+    EXPECT_FALSE(mask.GetBit(40));
+
+    ByteBuffer data;
+    mask.AppendToPacket(&data);
+    ASSERT_EQ(data.size(), 12u);
+    EXPECT_EQ(data.read<uint32>(), 0x80000001u);
+    EXPECT_EQ(data.read<uint32>(), 0x00000001u);
+    EXPECT_EQ(data.read<uint32>(), 0x00000020u);
+
+    std::vector<uint32> indexes;
+    mask.ForEachSetBit([&](uint32 index) { indexes.push_back(index); });
+    EXPECT_EQ(indexes, (std::vector<uint32>{ 0, 31, 32, 69 }));
+}
+
+TEST(UpdateMaskTest, FlagMasksMatchFlagTables)
+{
+    for (uint32 visibleFlag = 0; visibleFlag < (1 << UF_FLAG_COUNT); ++visibleFlag)
+    {
+        for (uint32 index = 0; index < PLAYER_END; ++index)
+        {
+            bool visible = (UnitUpdateFieldFlags[index] & visibleFlag) != 0;
+            bool masked = (UnitUpdateFieldFlagMasks.GetBlock(visibleFlag, index / UpdateMask::CLIENT_UPDATE_MASK_BITS) >> (index % UpdateMask::CLIENT_UPDATE_MASK_BITS)) & 1;
+            ASSERT_EQ(visible, masked) << "flags " << visibleFlag << " field " << index;
+        }
+
+        for (uint32 index = 0; index < GAMEOBJECT_END; ++index)
+        {
+            bool visible = (GameObjectUpdateFieldFlags[index] & visibleFlag) != 0;
+            bool masked = (GameObjectUpdateFieldFlagMasks.GetBlock(visibleFlag, index / UpdateMask::CLIENT_UPDATE_MASK_BITS) >> (index % UpdateMask::CLIENT_UPDATE_MASK_BITS)) & 1;
+            ASSERT_EQ(visible, masked) << "flags " << visibleFlag << " field " << index;
+        }
+    }
+}
+
+} // namespace
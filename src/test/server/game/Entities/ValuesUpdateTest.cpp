@@ -0,0 +1,175 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Values updates of a unit are built once per visibility class and shared by
+ * all viewers of that class. The shared blocks must match the blocks built
+ * for each viewer on its own.
+ */
+
+#include "Group.h"
+#include "Player.h"
+#include "ScriptMgr.h"
+#include "TestPlayer.h"
+#include "UpdateData.h"
+#include "WorldPacket.h"
+#include "ScriptDefines/GroupScript.h"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include <chrono>
+#include <initializer_list>
+#include <iostream>
+
+using namespace testing;
+
+namespace
+{
+
+std::vector<uint8> BuildPacket(UpdateData& data)
+{
+    WorldPacket packet;
+    data.BuildPacket(packet);
+    return std::vector<uint8>(packet.contents(), packet.contents() + packet.size());
+}
+
+// sends the values as changed again: ClearUpdateMask drops the changes and the values blocks cached for them
+void SetChangedValues(Object* object, std::initializer_list<std::pair<uint16, uint32>> values)
+{
+    object->ClearUpdateMask(false);
+
+    for (auto const& [index, value] : values)
+    {
+        object->SetUInt32Value(index, value + 1);
+        object->SetUInt32Value(index, value);
+    }
+}
+
+class ValuesUpdateTest : public TestPlayerFixture
+{
+protected:
+    static constexpr uint32 RaidSize = 40;
+    static constexpr uint32 Outsiders = 5;
+
+    void SetUp() override
+    {
+        TestPlayerFixture::SetUp();
+        ScriptRegistry<GroupScript>::InitEnabledHooksIfNeeded(GROUPHOOK_END);
+
+        raid = new Group();
+
+        for (uint32 i = 0; i < RaidSize + Outsiders; ++i)
+        {
+            TestPlayer* player = CreatePlayer(i + 1);
+            if (i < RaidSize)
+                player->SetGroup(raid, int8(i / MAXGROUPSIZE));
+
+            players.push_back(player);
+        }
+    }
+
+    void TearDown() override
+    {
+        // the players leave the group when they are destroyed
+        TestPlayerFixture::TearDown();
+        players.clear();
+
+        delete raid;
+        raid = nullptr;
+    }
+
+    // what WorldObject::BuildUpdate does for the tank and everyone seeing it
+    void BuildUpdate(Player* tank, UpdateDataMapType& dataMap)
+    {
+        for (Player* viewer : players)
+            tank->BuildFieldsUpdate(viewer, dataMap);
+    }
+
+    Group* raid = nullptr;
+    std::vector<Player*> players;
+};
+
+// cppcheck-suppress syntaxError
+TEST_F(ValuesUpdateTest, SharedBlocksMatchPerViewerBlocks)
+{
+    Player* tank = players.front();
+    SetChangedValues(tank, { { UNIT_FIELD_HEALTH, 54321 }, { UNIT_FIELD_POWER1, 1234 } });
+
+    UpdateDataMapType shared;
+    BuildUpdate(tank, shared);
+    ASSERT_EQ(shared.size(), players.size());
+
+    for (Player* viewer : players)
+    {
+        SetChangedValues(tank, { { UNIT_FIELD_HEALTH, 54321 }, { UNIT_FIELD_POWER1, 1234 } });
+
+        UpdateData alone;
+        tank->BuildValuesUpdateBlockForPlayer(&alone, viewer);
+        EXPECT_EQ(BuildPacket(shared[viewer]), BuildPacket(alone)) << "viewer " << viewer->GetGUID().GetCounter();
+    }
+
+    tank->ClearUpdateMask(false);
+}
+
+TEST_F(ValuesUpdateTest, ClearedChangesAreNotSentAgain)
+{
+    Player* tank = players.front();
+    Player* healer = players[1];
+
+    tank->SetHealth(1000);
+    UpdateDataMapType first;
+    BuildUpdate(tank, first);
+    tank->ClearUpdateMask(false);
+
+    // the block of the previous update must not be reused once its changes are sent
+    tank->SetUInt32Value(UNIT_FIELD_POWER1, 42);
+    UpdateData second;
+    tank->BuildValuesUpdateBlockForPlayer(&second, healer);
+
+    SetChangedValues(tank, { { UNIT_FIELD_POWER1, 42 } });
+    UpdateData expected;
+    tank->BuildValuesUpdateBlockForPlayer(&expected, healer);
+
+    EXPECT_NE(BuildPacket(first[healer]), BuildPacket(second));
+    EXPECT_EQ(BuildPacket(second), BuildPacket(expected));
+}
+
+TEST_F(ValuesUpdateTest, DISABLED_BenchmarkRaidHealthTick)
+{
+    static constexpr uint32 Ticks = 20000;
+
+    Player* tank = players.front();
+
+    auto start = std::chrono::steady_clock::now();
+    std::size_t bytes = 0;
+    for (uint32 tick = 0; tick < Ticks; ++tick)
+    {
+        tank->SetHealth(50000 + tick % 1000);
+
+        UpdateDataMapType dataMap;
+        BuildUpdate(tank, dataMap);
+        tank->ClearUpdateMask(false);
+
+        for (auto& [viewer, data] : dataMap)
+            bytes += BuildPacket(data).size();
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    std::cout << Ticks << " ticks, " << players.size() << " viewers: "
+        << std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count() << " ms, " << bytes << " bytes" << std::endl;
+}
+
+} // namespace
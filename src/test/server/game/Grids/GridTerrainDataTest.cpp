@@ -0,0 +1,203 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Batched terrain sampling must return exactly what the per point getters
+ * return, for every height storage format, holes and liquid maps.
+ */
+
+#include "GridDefines.h"
+#include "GridTerrainData.h"
+#include "gtest/gtest.h"
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <random>
+
+namespace
+{
+
+template<class T>
+void WriteValue(std::ofstream& file, T const& value)
+{
+    file.write(reinterpret_cast<char const*>(&value), sizeof(T));
+}
+
+// a .map tile with random heights stored as heightFlags, holes and a liquid level map
+std::string WriteTile(std::string const& name, uint32 heightFlags)
+{
+    std::string path = (std::filesystem::temp_directory_path() / name).string();
+    std::ofstream file(path, std::ios::binary);
+    std::mt19937 rng(12345);
+
+    std::size_t const valueSize = (heightFlags & MAP_HEIGHT_AS_INT16) ? 2 : (heightFlags & MAP_HEIGHT_AS_INT8) ? 1 : 4;
+    uint32 const heightSize = sizeof(map_heightHeader) + (129 * 129 + 128 * 128) * valueSize;
+    uint32 const liquidSize = sizeof(map_liquidHeader) + 32 * 48 * sizeof(float);
+
+    map_fileheader header = { };
+    header.mapMagic = MapMagic.asUInt;
+    header.versionMagic = MapVersionMagic;
+    header.heightMapOffset = sizeof(map_fileheader);
+    header.heightMapSize = heightSize;
+    header.liquidMapOffset = header.heightMapOffset + heightSize;
+    header.liquidMapSize = liquidSize;
+    header.holesOffset = header.liquidMapOffset + liquidSize;
+    header.holesSize = sizeof(LoadedHoleData::HolesType);
+    WriteValue(file, header);
+
+    map_heightHeader heightHeader = { MapHeightMagic.asUInt, heightFlags, -50.0f, 250.0f };
+    WriteValue(file, heightHeader);
+    for (uint32 i = 0; i < 129 * 129 + 128 * 128; ++i)
+    {
+        if (valueSize == 2)
+            WriteValue(file, uint16(rng()));
+        else if (valueSize == 1)
+            WriteValue(file, uint8(rng()));
+        else
+            WriteValue(file, std::uniform_real_distribution<float>(-50.0f, 250.0f)(rng));
+    }
+
+    map_liquidHeader liquidHeader = { MapLiquidMagic.asUInt, MAP_LIQUID_NO_TYPE, MAP_LIQUID_TYPE_WATER, 0, 20, 40, 32, 48, 0.0f };
+    WriteValue(file, liquidHeader);
+    for (uint32 i = 0; i < 32 * 48; ++i)
+        WriteValue(file, std::uniform_real_distribution<float>(0.0f, 100.0f)(rng));
+
+    for (uint32 i = 0; i < 16 * 16; ++i)
+        WriteValue(file, uint16(i % 5 ? 0 : rng()));
+
+    return path;
+}
+
+// random points all over the grid holding the map origin
+void RandomPoints(std::size_t count, std::vector<float>& x, std::vector<float>& y)
+{
+    std::mt19937 rng(54321);
+    std::uniform_real_distribution<float> coord(0.0f, SIZE_OF_GRIDS - 0.01f);
+
+    x.resize(count);
+    y.resize(count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        x[i] = coord(rng);
+        y[i] = coord(rng);
+    }
+}
+
+class GridTerrainDataTest : public ::testing::TestWithParam<uint32>
+{
+};
+
+// cppcheck-suppress syntaxError
+TEST_P(GridTerrainDataTest, BatchedSamplingMatchesScalar)
+{
+    GridTerrainData terrain;
+    ASSERT_EQ(terrain.Load(WriteTile("GridTerrainDataTest.map", GetParam())), TerrainMapDataReadResult::Success);
+
+    std::vector<float> x, y;
+    RandomPoints(4096, x, y);
+
+    std::vector<float> heights(x.size());
+    std::vector<float> levels(x.size());
+    terrain.getHeights(x.data(), y.data(), heights.data(), x.size());
+    terrain.getLiquidLevels(x.data(), y.data(), levels.data(), x.size());
+
+    uint32 holes = 0;
+    uint32 liquids = 0;
+    for (std::size_t i = 0; i < x.size(); ++i)
+    {
+        EXPECT_EQ(heights[i], terrain.getHeight(x[i], y[i])) << x[i] << " " << y[i];
+        EXPECT_EQ(levels[i], terrain.getLiquidLevel(x[i], y[i])) << x[i] << " " << y[i];
+
+        holes += heights[i] == INVALID_HEIGHT;
+        liquids += levels[i] != INVALID_HEIGHT;
+    }
+
+    // the tile really has both
+    EXPECT_GT(holes, 0u);
+    EXPECT_GT(liquids, 0u);
+}
+
+TEST_P(GridTerrainDataTest, BatchedLiquidDataMatchesScalar)
+{
+    GridTerrainData terrain;
+    ASSERT_EQ(terrain.Load(WriteTile("GridTerrainDataTest.map", GetParam())), TerrainMapDataReadResult::Success);
+
+    std::vector<float> x, y;
+    RandomPoints(4096, x, y);
+
+    // above, in and under the liquid
+    std::vector<float> z(x.size());
+    for (std::size_t i = 0; i < z.size(); ++i)
+        z[i] = float(i % 120) - 10.0f;
+
+    std::vector<LiquidData> liquidData(x.size());
+    terrain.GetLiquidData(x.data(), y.data(), z.data(), 2.0f, {}, liquidData.data(), x.size());
+
+    uint32 inLiquid = 0;
+    for (std::size_t i = 0; i < x.size(); ++i)
+    {
+        LiquidData const scalar = terrain.GetLiquidData(x[i], y[i], z[i], 2.0f, {});
+        EXPECT_EQ(liquidData[i].Status, scalar.Status) << x[i] << " " << y[i] << " " << z[i];
+        EXPECT_EQ(liquidData[i].Level, scalar.Level) << x[i] << " " << y[i] << " " << z[i];
+        EXPECT_EQ(liquidData[i].DepthLevel, scalar.DepthLevel) << x[i] << " " << y[i] << " " << z[i];
+        EXPECT_EQ(liquidData[i].Flags, scalar.Flags) << x[i] << " " << y[i] << " " << z[i];
+
+        inLiquid += (liquidData[i].Status & MAP_LIQUID_STATUS_SWIMMING) != 0;
+    }
+
+    EXPECT_GT(inLiquid, 0u);
+}
+
+INSTANTIATE_TEST_SUITE_P(HeightFormats, GridTerrainDataTest, ::testing::Values(0u, uint32(MAP_HEIGHT_AS_INT16), uint32(MAP_HEIGHT_AS_INT8)));
+
+TEST(GridTerrainDataBenchmark, DISABLED_BatchedVsScalarHeights)
+{
+    // AC_BENCHMARK_MAP_TILE may point to an extracted maps/*.map tile, otherwise a generated one is used
+    char const* tile = std::getenv("AC_BENCHMARK_MAP_TILE");
+
+    GridTerrainData terrain;
+    ASSERT_EQ(terrain.Load(tile ? tile : WriteTile("GridTerrainDataBenchmark.map", MAP_HEIGHT_AS_INT16)), TerrainMapDataReadResult::Success);
+
+    static constexpr std::size_t Points = 1 << 16;
+    static constexpr uint32 Rounds = 200;
+
+    std::vector<float> x, y;
+    RandomPoints(Points, x, y);
+    std::vector<float> heights(Points);
+
+    float sum = 0.0f;
+    auto start = std::chrono::steady_clock::now();
+    for (uint32 round = 0; round < Rounds; ++round)
+        for (std::size_t i = 0; i < Points; ++i)
+            sum += terrain.getHeight(x[i], y[i]);
+    auto scalar = std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+    for (uint32 round = 0; round < Rounds; ++round)
+    {
+        terrain.getHeights(x.data(), y.data(), heights.data(), Points);
+        sum += heights[round % Points];
+    }
+    auto batched = std::chrono::steady_clock::now() - start;
+
+    std::cout << "scalar: " << std::chrono::duration<double, std::nano>(scalar).count() / (Points * Rounds) << " ns per point, "
+        << "batched: " << std::chrono::duration<double, std::nano>(batched).count() / (Points * Rounds) << " ns per point"
+        << " (" << sum << ")" << std::endl;
+}
+
+} // namespace
@@ -0,0 +1,116 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Pooled battleground maps are taken and refilled per spawn mode, so brackets
+ * with different difficulties never block each other's pool.
+ */
+
+#include "BattlegroundMapPool.h"
+#include "gtest/gtest.h"
+#include <cstddef>
+#include <cstdint>
+
+namespace
+{
+
+// the pool never dereferences maps, it only stores them: distinct, suitably aligned fake addresses are enough
+BattlegroundMap* GetMap(uint32 index)
+{
+    return reinterpret_cast<BattlegroundMap*>(std::uintptr_t(index + 1) * alignof(std::max_align_t));
+}
+
+constexpr std::size_t PoolSize = 2;
+
+// what MapMgr::Update does for a base map, one map per call
+bool Refill(BattlegroundMapPool& pool, uint32& nextMap)
+{
+    Optional<uint8> spawnMode = pool.GetSpawnModeToFill(PoolSize);
+    if (!spawnMode)
+        return false;
+
+    pool.Add(*spawnMode, GetMap(nextMap++));
+    return true;
+}
+
+TEST(BattlegroundMapPoolTest, NothingIsBuiltBeforeABattlegroundAsks)
+{
+    BattlegroundMapPool pool;
+    EXPECT_FALSE(pool.GetSpawnModeToFill(PoolSize));
+}
+
+TEST(BattlegroundMapPoolTest, TakeRefillsTheRequestedSpawnMode)
+{
+    BattlegroundMapPool pool;
+    uint32 nextMap = 0;
+
+    // the first battleground of a bracket has no pooled map yet
+    EXPECT_EQ(pool.Take(1), nullptr);
+
+    EXPECT_TRUE(Refill(pool, nextMap));
+    EXPECT_TRUE(Refill(pool, nextMap));
+    EXPECT_FALSE(Refill(pool, nextMap));
+    EXPECT_EQ(pool.GetSize(1), PoolSize);
+
+    BattlegroundMap* map = pool.Take(1);
+    EXPECT_TRUE(map == GetMap(0) || map == GetMap(1));
+    EXPECT_EQ(pool.GetSize(1), PoolSize - 1);
+
+    EXPECT_TRUE(Refill(pool, nextMap));
+    EXPECT_EQ(pool.GetSize(1), PoolSize);
+}
+
+TEST(BattlegroundMapPoolTest, SpawnModesDoNotShareMaps)
+{
+    BattlegroundMapPool pool;
+    uint32 nextMap = 0;
+
+    EXPECT_EQ(pool.Take(0), nullptr);
+    while (Refill(pool, nextMap));
+    EXPECT_EQ(pool.GetSize(0), PoolSize);
+
+    // a full pool of another mode neither serves nor blocks this one
+    EXPECT_EQ(pool.Take(1), nullptr);
+    EXPECT_EQ(pool.GetSpawnModeToFill(PoolSize), Optional<uint8>(1));
+
+    while (Refill(pool, nextMap));
+    EXPECT_EQ(pool.GetSize(0), PoolSize);
+    EXPECT_EQ(pool.GetSize(1), PoolSize);
+
+    // alternating brackets are refilled where they were drained
+    pool.Take(0);
+    pool.Take(1);
+    pool.Take(1);
+    EXPECT_EQ(pool.GetSpawnModeToFill(PoolSize), Optional<uint8>(1));
+}
+
+TEST(BattlegroundMapPoolTest, ClearHandsBackEveryMap)
+{
+    BattlegroundMapPool pool;
+    uint32 nextMap = 0;
+
+    pool.Take(0);
+    pool.Take(1);
+    while (Refill(pool, nextMap));
+
+    std::vector<BattlegroundMap*> maps = pool.Clear();
+    EXPECT_EQ(maps.size(), nextMap);
+    EXPECT_EQ(pool.GetSize(0), 0u);
+    EXPECT_EQ(pool.GetSize(1), 0u);
+}
+
+} // namespace
@@ -0,0 +1,174 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Object updates built in chunks on worker threads must reach every player
+ * in the same order as when they are built one by one on the map thread.
+ */
+
+#include "ObjectUpdateBuilder.h"
+#include "ScriptMgr.h"
+#include "UpdateData.h"
+#include "WorldPacket.h"
+#include "ScriptDefines/MiscScript.h"
+#include "gtest/gtest.h"
+#include <memory>
+
+namespace
+{
+
+constexpr uint32 Viewers = 7;
+
+// the builder never dereferences players, it only groups the blocks by them
+uint8 ViewerStorage[Viewers];
+
+Player* GetViewer(uint32 index)
+{
+    return reinterpret_cast<Player*>(&ViewerStorage[index]);
+}
+
+class TestObject : public Object
+{
+public:
+    explicit TestObject(ObjectGuid::LowType guidLow)
+    {
+        m_valuesCount = OBJECT_END;
+        _Create(guidLow, 0, HighGuid::Unit);
+        AddToWorld();
+    }
+
+    ~TestObject() override
+    {
+        RemoveFromWorld();
+    }
+
+    // every object is seen by a different subset of the viewers
+    void BuildUpdate(UpdateDataMapType& dataMap) override
+    {
+        for (uint32 i = 0; i < Viewers; ++i)
+        {
+            if ((GetGUID().GetCounter() + i) % 3 == 0)
+                continue;
+
+            ByteBuffer& block = dataMap[GetViewer(i)].StartUpdateBlock();
+            block << uint8(UPDATETYPE_VALUES) << GetGUID().GetCounter();
+        }
+    }
+
+private:
+    void AddToObjectUpdate() override { }
+    void RemoveFromObjectUpdate() override { }
+};
+
+std::vector<uint8> BuildPacket(UpdateData& data)
+{
+    WorldPacket packet;
+    data.BuildPacket(packet);
+    return std::vector<uint8>(packet.contents(), packet.contents() + packet.size());
+}
+
+class ObjectUpdateBuilderTest : public ::testing::Test
+{
+protected:
+    static constexpr uint32 ObjectCount = 1000;
+
+    void SetUp() override
+    {
+        ScriptRegistry<MiscScript>::InitEnabledHooksIfNeeded(MISCHOOK_END);
+
+        for (uint32 i = 0; i < ObjectCount; ++i)
+        {
+            objects.push_back(std::make_unique<TestObject>(i + 1));
+            buildList.push_back(objects.back().get());
+        }
+    }
+
+    // what Map::SendObjectUpdates does before sending, returns the packet of every viewer
+    std::vector<std::vector<uint8>> BuildAndMerge(ObjectUpdateBuilder& builder, std::vector<UpdateDataMapType>& staging)
+    {
+        std::size_t chunkCount = builder.GetChunkCount(buildList.size());
+        if (staging.size() < chunkCount)
+            staging.resize(chunkCount);
+
+        builder.Build(buildList, staging.data(), chunkCount);
+        ObjectUpdateBuilder::Merge(staging.data(), chunkCount);
+
+        std::vector<std::vector<uint8>> packets;
+        for (uint32 i = 0; i < Viewers; ++i)
+        {
+            packets.push_back(BuildPacket(staging[0][GetViewer(i)]));
+            staging[0][GetViewer(i)].Clear();
+        }
+
+        return packets;
+    }
+
+    std::vector<std::unique_ptr<TestObject>> objects;
+    std::vector<Object*> buildList;
+};
+
+// cppcheck-suppress syntaxError
+TEST_F(ObjectUpdateBuilderTest, ChunkCount)
+{
+    ObjectUpdateBuilder builder;
+    EXPECT_EQ(builder.GetChunkCount(100000), 1u);
+
+    builder.Activate(3);
+    EXPECT_EQ(builder.GetChunkCount(0), 1u);
+    EXPECT_EQ(builder.GetChunkCount(ObjectUpdateBuilder::MinObjectsPerChunk * 2), 2u);
+    EXPECT_EQ(builder.GetChunkCount(100000), 4u);
+    builder.Deactivate();
+
+    EXPECT_FALSE(builder.IsActive());
+}
+
+TEST_F(ObjectUpdateBuilderTest, ChunkedBuildMatchesSerialBuild)
+{
+    ObjectUpdateBuilder serial;
+    std::vector<UpdateDataMapType> serialStaging;
+    std::vector<std::vector<uint8>> expected = BuildAndMerge(serial, serialStaging);
+
+    ObjectUpdateBuilder chunked;
+    chunked.Activate(3);
+    ASSERT_EQ(chunked.GetChunkCount(buildList.size()), 4u);
+
+    std::vector<UpdateDataMapType> chunkedStaging;
+
+    // staging maps are reused between updates, the second update must not repeat the first one
+    for (uint32 update = 0; update < 2; ++update)
+    {
+        std::vector<std::vector<uint8>> packets = BuildAndMerge(chunked, chunkedStaging);
+        for (uint32 i = 0; i < Viewers; ++i)
+            EXPECT_EQ(packets[i], expected[i]) << "viewer " << i << ", update " << update;
+    }
+}
+
+TEST_F(ObjectUpdateBuilderTest, MergeDropsPlayersWithoutData)
+{
+    std::vector<UpdateDataMapType> staging(3);
+    staging[1][GetViewer(0)].StartUpdateBlock() << uint8(UPDATETYPE_VALUES);
+    staging[2][GetViewer(1)];
+
+    ObjectUpdateBuilder::Merge(staging.data(), staging.size());
+
+    EXPECT_TRUE(staging[0][GetViewer(0)].HasData());
+    EXPECT_EQ(staging[0].count(GetViewer(1)), 0u);
+    EXPECT_FALSE(staging[1][GetViewer(0)].HasData());
+    EXPECT_TRUE(staging[2].empty());
+}
+
+} // namespace
@@ -0,0 +1,104 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Respawn time changes of a map are merged per spawn before Map writes them,
+ * only what the database does not hold yet may reach it.
+ */
+
+#include "RespawnTimeSaveQueue.h"
+#include "gtest/gtest.h"
+#include <map>
+#include <set>
+
+namespace
+{
+
+struct Written
+{
+    std::map<ObjectGuid::LowType, time_t> Replaced;
+    std::set<ObjectGuid::LowType> Removed;
+};
+
+Written Flush(RespawnTimeSaveQueue& queue)
+{
+    Written written;
+    queue.Flush([&](ObjectGuid::LowType spawnId, time_t respawnTime) { written.Replaced[spawnId] = respawnTime; },
+        [&](ObjectGuid::LowType spawnId) { written.Removed.insert(spawnId); });
+    return written;
+}
+
+TEST(RespawnTimeSaveQueueTest, LatestRespawnTimeWins)
+{
+    RespawnTimeSaveQueue queue;
+    queue.Queue(1, 100, false);
+    queue.Queue(1, 200, true);
+    queue.Queue(2, 300, false);
+
+    Written written = Flush(queue);
+    EXPECT_EQ(written.Replaced, (std::map<ObjectGuid::LowType, time_t>{ { 1, 200 }, { 2, 300 } }));
+    EXPECT_TRUE(written.Removed.empty());
+}
+
+TEST(RespawnTimeSaveQueueTest, DeleteCancelsUnwrittenInsert)
+{
+    RespawnTimeSaveQueue queue;
+    queue.Queue(1, 100, false);
+    queue.Queue(1, 0, true);                                // the row is in memory by now, not in the database
+
+    Written written = Flush(queue);
+    EXPECT_TRUE(written.Replaced.empty());
+    EXPECT_TRUE(written.Removed.empty());
+}
+
+TEST(RespawnTimeSaveQueueTest, DeleteReplacesUpdateOfStoredRow)
+{
+    RespawnTimeSaveQueue queue;
+    queue.Queue(1, 100, true);
+    queue.Queue(1, 0, true);
+    queue.Queue(2, 0, true);
+
+    Written written = Flush(queue);
+    EXPECT_TRUE(written.Replaced.empty());
+    EXPECT_EQ(written.Removed, (std::set<ObjectGuid::LowType>{ 1, 2 }));
+}
+
+TEST(RespawnTimeSaveQueueTest, InsertAfterDeleteIsWritten)
+{
+    RespawnTimeSaveQueue queue;
+    queue.Queue(1, 0, true);
+    queue.Queue(1, 100, false);
+
+    Written written = Flush(queue);
+    EXPECT_EQ(written.Replaced, (std::map<ObjectGuid::LowType, time_t>{ { 1, 100 } }));
+    EXPECT_TRUE(written.Removed.empty());
+}
+
+TEST(RespawnTimeSaveQueueTest, FlushAndClearDropPendingChanges)
+{
+    RespawnTimeSaveQueue queue;
+    queue.Queue(1, 100, false);
+    Flush(queue);
+    EXPECT_TRUE(queue.Empty());
+
+    queue.Queue(2, 100, false);
+    queue.Clear();
+    EXPECT_TRUE(queue.Empty());
+    EXPECT_TRUE(Flush(queue).Replaced.empty());
+}
+
+} // namespace
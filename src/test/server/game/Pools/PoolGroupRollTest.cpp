@@ -0,0 +1,158 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * PoolGroup rolls: explicitly chanced members are picked through the running
+ * chance sums, equal chanced members through a single reservoir sampling pass.
+ * Pool of pool groups are used so spawning does not need any map.
+ */
+
+#include "PoolMgr.h"
+#include "gtest/gtest.h"
+
+namespace
+{
+
+static constexpr uint32 TEST_POOL_ID = 99990;
+
+uint32 CountActive(ActivePoolData const& spawns, std::vector<PoolObject> const& objects)
+{
+    uint32 count = 0;
+    for (PoolObject const& obj : objects)
+        if (spawns.IsActiveObject<Pool>(obj.guid))
+            ++count;
+    return count;
+}
+
+// cppcheck-suppress syntaxError
+TEST(PoolGroupRollTest, ExplicitChanceSkipsZeroWidthMembers)
+{
+    PoolGroup<Pool> group;
+    group.SetPoolId(TEST_POOL_ID);
+
+    PoolObject never(99991, 0.001f);
+    PoolObject always(99992, 99.999f);
+    group.AddEntry(never, 1);
+    group.AddEntry(always, 1);
+
+    uint32 alwaysSpawned = 0;
+    for (uint32 i = 0; i < 100; ++i)
+    {
+        ActivePoolData spawns;
+        group.SpawnObject(spawns, 1, 0);
+
+        EXPECT_EQ(CountActive(spawns, group.GetExplicitlyChanced()), 1u);
+        if (spawns.IsActiveObject<Pool>(always.guid))
+            ++alwaysSpawned;
+    }
+
+    EXPECT_GE(alwaysSpawned, 95u);
+}
+
+TEST(PoolGroupRollTest, ExplicitChanceFallsThroughToNextFreeMember)
+{
+    PoolGroup<Pool> group;
+    group.SetPoolId(TEST_POOL_ID);
+
+    PoolObject first(99991, 99.999f);
+    PoolObject second(99992, 0.001f);
+    group.AddEntry(first, 1);
+    group.AddEntry(second, 1);
+
+    // the roll (nearly) always lands on the first member, which is already spawned
+    ActivePoolData spawns;
+    spawns.ActivateObject<Pool>(first.guid, TEST_POOL_ID);
+    group.SpawnObject(spawns, 2, 0);
+
+    EXPECT_TRUE(spawns.IsActiveObject<Pool>(first.guid));
+    EXPECT_TRUE(spawns.IsActiveObject<Pool>(second.guid));
+    EXPECT_EQ(spawns.GetActiveObjectCount(TEST_POOL_ID), 2u);
+}
+
+TEST(PoolGroupRollTest, RemovedRelationIsNeverRolled)
+{
+    PoolGroup<Pool> group;
+    group.SetPoolId(TEST_POOL_ID);
+
+    PoolObject removed(99991, 99.0f);
+    PoolObject kept(99992, 1.0f);
+    group.AddEntry(removed, 1);
+    group.AddEntry(kept, 1);
+    group.RemoveOneRelation(removed.guid);
+
+    ActivePoolData spawns;
+    group.SpawnObject(spawns, 1, 0);
+
+    // the rebuilt table only covers the first percent of the roll now
+    EXPECT_FALSE(spawns.IsActiveObject<Pool>(removed.guid));
+}
+
+TEST(PoolGroupRollTest, EqualChanceSpawnsUpToLimit)
+{
+    PoolGroup<Pool> group;
+    group.SetPoolId(TEST_POOL_ID);
+
+    for (uint32 guid = 99980; guid < 99990; ++guid)
+    {
+        PoolObject obj(guid, 0.0f);
+        group.AddEntry(obj, 3);
+    }
+
+    std::map<uint32, uint32> rolled;
+    for (uint32 i = 0; i < 200; ++i)
+    {
+        ActivePoolData spawns;
+        group.SpawnObject(spawns, 3, 0);
+
+        EXPECT_EQ(CountActive(spawns, group.GetEqualChanced()), 3u);
+        EXPECT_EQ(spawns.GetActiveObjectCount(TEST_POOL_ID), 3u);
+
+        for (PoolObject const& obj : group.GetEqualChanced())
+            if (spawns.IsActiveObject<Pool>(obj.guid))
+                ++rolled[obj.guid];
+    }
+
+    // 600 picks over 10 members, every member must show up
+    EXPECT_EQ(rolled.size(), 10u);
+}
+
+TEST(PoolGroupRollTest, EqualChanceRespawnKeepsCount)
+{
+    PoolGroup<Pool> group;
+    group.SetPoolId(TEST_POOL_ID);
+
+    for (uint32 guid = 99980; guid < 99985; ++guid)
+    {
+        PoolObject obj(guid, 0.0f);
+        group.AddEntry(obj, 2);
+    }
+
+    ActivePoolData spawns;
+    group.SpawnObject(spawns, 2, 0);
+    ASSERT_EQ(CountActive(spawns, group.GetEqualChanced()), 2u);
+
+    uint32 respawning = 0;
+    for (PoolObject const& obj : group.GetEqualChanced())
+        if (spawns.IsActiveObject<Pool>(obj.guid))
+            respawning = obj.guid;
+
+    // one object respawning, the pool keeps the same amount of active members
+    group.SpawnObject(spawns, 2, respawning);
+    EXPECT_EQ(CountActive(spawns, group.GetEqualChanced()), 2u);
+}
+
+} // namespace
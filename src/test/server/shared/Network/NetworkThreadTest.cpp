@@ -0,0 +1,191 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * How a network thread gets to update its sockets, and what idle connections cost it:
+ * without packets to send or database callbacks to poll, open sockets are not updated at all.
+ */
+
+#include "NetworkThread.h"
+#include "gtest/gtest.h"
+#include <chrono>
+#include <ctime>
+#include <iostream>
+
+namespace
+{
+
+// stands for a connection without a system socket behind it
+class IdleSocket
+{
+public:
+    void Start() { }
+    bool Update() { ++Updates; return Open; }
+    [[nodiscard]] bool IsOpen() const { return Open; }
+    void CloseSocket() { }
+
+    [[nodiscard]] ProxyHeaderReadingState GetProxyHeaderReadingState() const { return PROXY_HEADER_READING_STATE_FINISHED; }
+    void AsyncReadProxyHeader() { }
+
+    std::atomic<bool> Open = true;
+    std::atomic<uint32> Updates = 0;
+};
+
+// counts its updates and remembers the thread they ran on
+class CountingSocket : public Socket<CountingSocket>
+{
+public:
+    using Socket::Socket;
+
+    void Start() override { }
+
+    bool Update() override
+    {
+        ++Updates;
+        UpdateThread = std::this_thread::get_id();
+        return Socket::Update();
+    }
+
+    uint32 Updates = 0;
+    std::thread::id UpdateThread;
+
+protected:
+    SocketReadCallbackResult ReadHandler() override { return SocketReadCallbackResult::KeepReading; }
+};
+
+class SocketUpdateTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        tcp::acceptor acceptor(_ioContext, tcp::endpoint(boost::asio::ip::address_v4::loopback(), 0));
+        _client.connect(acceptor.local_endpoint());
+
+        IoContextTcpSocket serverSide(_ioContext);
+        acceptor.accept(serverSide);
+        _socket = std::make_shared<CountingSocket>(std::move(serverSide));
+    }
+
+    // runs the handlers posted so far on a network thread of its own, returns that thread's id
+    std::thread::id RunNetworkThread()
+    {
+        _ioContext.restart();
+        std::thread networkThread([this]() { _ioContext.run(); });
+        std::thread::id networkThreadId = networkThread.get_id();
+        networkThread.join();
+        return networkThreadId;
+    }
+
+    boost::asio::io_context _ioContext;
+    tcp::socket _client{ _ioContext };
+    std::shared_ptr<CountingSocket> _socket;
+};
+
+TEST_F(SocketUpdateTest, QueuedUpdatesAreMergedAndRunOnTheSocketExecutor)
+{
+    // packets sent from the world thread before the network thread gets to run
+    std::thread worldThread([this]()
+    {
+        for (uint32 i = 0; i < 3; ++i)
+            _socket->QueueUpdate();
+    });
+    worldThread.join();
+    EXPECT_EQ(_socket->Updates, 0u);
+
+    std::thread::id networkThreadId = RunNetworkThread();
+    EXPECT_EQ(_socket->Updates, 1u);
+    EXPECT_EQ(_socket->UpdateThread, networkThreadId);
+
+    // once it ran, the next packet queues another update
+    _socket->QueueUpdate();
+    RunNetworkThread();
+    EXPECT_EQ(_socket->Updates, 2u);
+}
+
+TEST_F(SocketUpdateTest, DelayedUpdatesAreMerged)
+{
+    _socket->QueueDelayedUpdate(std::chrono::milliseconds(1));
+    _socket->QueueDelayedUpdate(std::chrono::milliseconds(1));
+
+    RunNetworkThread();
+    EXPECT_EQ(_socket->Updates, 1u);
+
+    _socket->QueueDelayedUpdate(std::chrono::milliseconds(1));
+    RunNetworkThread();
+    EXPECT_EQ(_socket->Updates, 2u);
+}
+
+TEST(NetworkThreadTest, SweepOnlyUpdatesClosedSockets)
+{
+    NetworkThread<IdleSocket> thread;
+
+    std::shared_ptr<IdleSocket> openSocket = std::make_shared<IdleSocket>();
+    std::shared_ptr<IdleSocket> closedSocket = std::make_shared<IdleSocket>();
+    thread.AddSocket(openSocket);
+    thread.AddSocket(closedSocket);
+
+    thread.Start();
+    std::this_thread::sleep_for(SOCKET_SWEEP_INTERVAL * 5);
+
+    closedSocket->Open = false;
+    std::this_thread::sleep_for(SOCKET_SWEEP_INTERVAL * 5);
+
+    thread.Stop();
+    thread.Wait();
+
+    EXPECT_EQ(openSocket->Updates, 0u);
+    EXPECT_EQ(closedSocket->Updates, 1u);
+    EXPECT_EQ(thread.GetConnectionCount(), 1);
+}
+
+class NetworkThreadBenchmark : public ::testing::TestWithParam<uint32>
+{
+};
+
+// cppcheck-suppress syntaxError
+TEST_P(NetworkThreadBenchmark, DISABLED_IdleConnectionCpu)
+{
+    NetworkThread<IdleSocket> thread;
+
+    std::vector<std::shared_ptr<IdleSocket>> sockets;
+    for (uint32 i = 0; i < GetParam(); ++i)
+    {
+        sockets.push_back(std::make_shared<IdleSocket>());
+        thread.AddSocket(sockets.back());
+    }
+
+    thread.Start();
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+
+    // the calling thread only sleeps, the process CPU time is the network thread's
+    std::clock_t cpuStart = std::clock();
+    auto start = std::chrono::steady_clock::now();
+    std::this_thread::sleep_for(std::chrono::seconds(2));
+    double cpu = double(std::clock() - cpuStart) / CLOCKS_PER_SEC;
+    double wall = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    thread.Stop();
+    thread.Wait();
+
+    EXPECT_EQ(sockets.front()->Updates, 0u);
+
+    std::cout << GetParam() << " idle sockets: " << 100.0 * cpu / wall << "% of a core" << std::endl;
+}
+
+INSTANTIATE_TEST_SUITE_P(Connections, NetworkThreadBenchmark, ::testing::Values(1000u, 5000u, 10000u));
+
+} // namespace
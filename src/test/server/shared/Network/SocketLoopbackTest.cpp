@@ -0,0 +1,147 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Loopback round trip latency and throughput of Socket<T> for the backend it is built with
+ * (AC_SOCKET_BACKEND), run once per build to compare a WITH_IO_URING build with the default one.
+ */
+
+#include "Socket.h"
+#include "gtest/gtest.h"
+#include <boost/asio/read.hpp>
+#include <boost/asio/write.hpp>
+#include <chrono>
+#include <ctime>
+#include <iostream>
+#include <thread>
+
+namespace
+{
+
+// sends back everything it reads, through the same queue and gathered write as the game sockets
+class EchoSocket : public Socket<EchoSocket>
+{
+public:
+    using Socket::Socket;
+
+    void Start() override { AsyncRead(); }
+
+protected:
+    SocketReadCallbackResult ReadHandler() override
+    {
+        MessageBuffer& packet = GetReadBuffer();
+
+        MessageBuffer echo(packet.GetActiveSize());
+        echo.Write(packet.GetReadPointer(), packet.GetActiveSize());
+        packet.ReadCompleted(packet.GetActiveSize());
+
+        QueuePacket(std::move(echo));
+        QueueUpdate();
+        return SocketReadCallbackResult::KeepReading;
+    }
+};
+
+class SocketLoopbackBenchmark : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        tcp::acceptor acceptor(_ioContext, tcp::endpoint(boost::asio::ip::address_v4::loopback(), 0));
+        _client.connect(acceptor.local_endpoint());
+        _client.set_option(tcp::no_delay(true));
+
+        IoContextTcpSocket serverSide(_ioContext);
+        acceptor.accept(serverSide);
+        serverSide.set_option(tcp::no_delay(true));
+
+        std::make_shared<EchoSocket>(std::move(serverSide))->Start();
+        _networkThread = std::thread([this]() { _ioContext.run(); });
+    }
+
+    void TearDown() override
+    {
+        // the echo socket closes itself on end of file, then the network thread runs out of work
+        _client.close();
+        _networkThread.join();
+    }
+
+    void Receive(uint8* data, std::size_t size)
+    {
+        boost::asio::read(_client, boost::asio::buffer(data, size));
+    }
+
+    boost::asio::io_context _ioContext;
+    boost::asio::io_context _clientContext;
+    tcp::socket _client{ _clientContext };
+    std::thread _networkThread;
+};
+
+TEST_F(SocketLoopbackBenchmark, DISABLED_RoundTripLatency)
+{
+    constexpr uint32 RoundTrips = 50000;
+    constexpr std::size_t MessageSize = 64;
+
+    std::vector<uint8> message(MessageSize, 0x5A);
+    std::vector<uint8> reply(MessageSize);
+
+    std::clock_t cpuStart = std::clock();
+    auto start = std::chrono::steady_clock::now();
+    for (uint32 i = 0; i < RoundTrips; ++i)
+    {
+        boost::asio::write(_client, boost::asio::buffer(message));
+        Receive(reply.data(), reply.size());
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    double cpu = double(std::clock() - cpuStart) / CLOCKS_PER_SEC;
+
+    EXPECT_EQ(reply, message);
+
+    std::cout << AC_SOCKET_BACKEND << ": " << RoundTrips << " round trips of " << MessageSize << " bytes, "
+        << 1e6 * seconds / RoundTrips << " us each, " << 1e6 * cpu / RoundTrips
+        << " us of CPU per round trip (client included)" << std::endl;
+}
+
+TEST_F(SocketLoopbackBenchmark, DISABLED_Throughput)
+{
+    constexpr uint32 Messages = 200000;
+    constexpr std::size_t MessageSize = 256;
+
+    std::clock_t cpuStart = std::clock();
+    auto start = std::chrono::steady_clock::now();
+
+    std::thread writer([this]()
+    {
+        std::vector<uint8> message(MessageSize, 0xA5);
+        for (uint32 i = 0; i < Messages; ++i)
+            boost::asio::write(_client, boost::asio::buffer(message));
+    });
+
+    std::vector<uint8> echoed(Messages * MessageSize);
+    Receive(echoed.data(), echoed.size());
+    writer.join();
+
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    double cpu = double(std::clock() - cpuStart) / CLOCKS_PER_SEC;
+
+    EXPECT_EQ(echoed.back(), 0xA5);
+
+    std::cout << AC_SOCKET_BACKEND << ": " << Messages << " messages of " << MessageSize << " bytes echoed at "
+        << echoed.size() / seconds / (1024 * 1024) << " MiB/s, " << 1e6 * cpu / Messages
+        << " us of CPU per message (client included)" << std::endl;
+}
+
+} // namespace
@@ -0,0 +1,259 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * map_extractor tile conversion: converting the same tiles on one or several
+ * threads, in any order, must write byte identical .map files.
+ * MPQ access is replaced by synthetic adt files kept in memory.
+ */
+
+#include "adt.h"
+#include "mapconverter.h"
+#include "mpq_libmpq04.h"
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <random>
+
+namespace
+{
+    std::map<std::string, std::vector<char>> SyntheticFiles;
+}
+
+MPQFile::MPQFile(const char* filename) :
+    eof(false),
+    buffer(nullptr),
+    pointer(0),
+    size(0)
+{
+    auto itr = SyntheticFiles.find(filename);
+    if (itr == SyntheticFiles.end())
+    {
+        eof = true;
+        return;
+    }
+
+    size = itr->second.size();
+    buffer = new char[size];
+    memcpy(buffer, itr->second.data(), size);
+}
+
+std::size_t MPQFile::read(void* dest, std::size_t bytes)
+{
+    if (eof)
+        return 0;
+
+    std::size_t rpos = pointer + bytes;
+    if (rpos > std::size_t(size))
+    {
+        bytes = size - pointer;
+        eof = true;
+    }
+
+    memcpy(dest, &buffer[pointer], bytes);
+    pointer = rpos;
+    return bytes;
+}
+
+void MPQFile::seek(int offset)
+{
+    pointer = offset;
+    eof = (pointer >= size);
+}
+
+void MPQFile::seekRelative(int offset)
+{
+    pointer += offset;
+    eof = (pointer >= size);
+}
+
+void MPQFile::close()
+{
+    delete[] buffer;
+    buffer = nullptr;
+    eof = true;
+}
+
+namespace
+{
+
+namespace fs = std::filesystem;
+
+static constexpr uint32 TEST_BUILD = 12340;
+static constexpr uint32 TEST_TILES = 24;
+
+void WriteChunkHeader(std::vector<char>& data, std::size_t offset, char const* fcc, uint32 size)
+{
+    memcpy(&data[offset], fcc, 4);
+    memcpy(&data[offset + 4], &size, sizeof(size));
+}
+
+// MVER, MHDR and MCIN followed by one MCNK with MCVT and MCLQ per cell, no MH2O
+std::vector<char> BuildTile(uint32 tile)
+{
+    std::mt19937 rng(tile);
+    std::uniform_real_distribution<float> noise(0.0f, 1.0f);
+
+    std::size_t const mhdrOffset = sizeof(file_MVER);
+    std::size_t const mcinOffset = mhdrOffset + sizeof(adt_MHDR);
+    std::size_t const firstCellOffset = mcinOffset + sizeof(adt_MCIN);
+    std::size_t const cellSize = sizeof(adt_MCNK) + sizeof(adt_MCVT) + sizeof(adt_MCLQ);
+
+    std::vector<char> data(firstCellOffset + ADT_CELLS_PER_GRID * ADT_CELLS_PER_GRID * cellSize, 0);
+
+    WriteChunkHeader(data, 0, "REVM", sizeof(uint32));
+    uint32 const version = FILE_FORMAT_VERSION;
+    memcpy(&data[8], &version, sizeof(version));
+
+    WriteChunkHeader(data, mhdrOffset, "RDHM", sizeof(adt_MHDR) - 8);
+    adt_MHDR* mhdr = reinterpret_cast<adt_MHDR*>(&data[mhdrOffset]);
+    mhdr->offsMCIN = mcinOffset - (mhdrOffset + 8);         // relative to MHDR data
+
+    WriteChunkHeader(data, mcinOffset, "NICM", sizeof(adt_MCIN) - 8);
+    adt_MCIN* mcin = reinterpret_cast<adt_MCIN*>(&data[mcinOffset]);
+
+    // tile kinds: flat, small height range with some water, large range with holes, mixed areas with water everywhere
+    uint32 const kind = tile % 4;
+    float const baseHeight = float(tile) * 10.0f;
+    float const range = kind == 0 ? 0.0f : (kind == 1 ? 5.0f : (kind == 2 ? 4000.0f : 300.0f));
+
+    for (uint32 i = 0; i < ADT_CELLS_PER_GRID; ++i)
+    {
+        for (uint32 j = 0; j < ADT_CELLS_PER_GRID; ++j)
+        {
+            std::size_t const cellOffset = firstCellOffset + (i * ADT_CELLS_PER_GRID + j) * cellSize;
+            mcin->cells[i][j].offsMCNK = cellOffset;
+            mcin->cells[i][j].size = cellSize;
+
+            WriteChunkHeader(data, cellOffset, "KNCM", cellSize - 8);
+            adt_MCNK* mcnk = reinterpret_cast<adt_MCNK*>(&data[cellOffset]);
+            mcnk->ix = j;
+            mcnk->iy = i;
+            mcnk->areaid = kind == 3 ? 100 + (i + j) % 3 : 100;
+            mcnk->holes = kind == 2 && (i + j) % 5 == 0 ? 0x0660 : 0;
+            mcnk->ypos = baseHeight;
+
+            // some cells come without height map
+            if (kind == 0 || (i * j + tile) % 7 != 0)
+            {
+                mcnk->offsMCVT = sizeof(adt_MCNK);
+                WriteChunkHeader(data, cellOffset + mcnk->offsMCVT, "TVCM", sizeof(adt_MCVT) - 8);
+                adt_MCVT* mcvt = mcnk->getMCVT();
+                for (float& height : mcvt->height_map)
+                    height = range * noise(rng);
+            }
+
+            bool const hasWater = kind == 3 || (kind == 1 && (i + j + tile) % 6 == 0);
+            if (!hasWater)
+                continue;
+
+            mcnk->flags |= 1 << 2;
+            mcnk->offsMCLQ = sizeof(adt_MCNK) + sizeof(adt_MCVT);
+            mcnk->sizeMCLQ = sizeof(adt_MCLQ);
+            WriteChunkHeader(data, cellOffset + mcnk->offsMCLQ, "QLCM", sizeof(adt_MCLQ) - 8);
+            adt_MCLQ* mclq = mcnk->getMCLQ();
+            for (auto& row : mclq->liquid)
+                for (auto& vertex : row)
+                    vertex.height = baseHeight + 2.0f * noise(rng);
+            for (auto& row : mclq->flags)
+                for (uint8& flag : row)
+                    flag = noise(rng) < 0.2f ? 0x0F : 0x04;
+        }
+    }
+
+    return data;
+}
+
+std::map<std::string, std::vector<char>> ReadOutput(fs::path const& dir)
+{
+    std::map<std::string, std::vector<char>> files;
+    for (fs::directory_entry const& entry : fs::directory_iterator(dir))
+    {
+        std::ifstream file(entry.path(), std::ios::binary);
+        files[entry.path().filename().string()].assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+    return files;
+}
+
+class MapConverterTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        _root = fs::temp_directory_path() / ("ac_mapconverter_" + std::to_string(std::random_device()()));
+        fs::create_directories(_root);
+
+        for (uint32 tile = 0; tile < TEST_TILES; ++tile)
+            SyntheticFiles["World\\Maps\\Test\\Test_" + std::to_string(tile) + ".adt"] = BuildTile(tile);
+    }
+
+    void TearDown() override
+    {
+        SyntheticFiles.clear();
+        std::error_code error;
+        fs::remove_all(_root, error);
+    }
+
+    fs::path Convert(std::string const& name, uint32 threads, bool reversed)
+    {
+        fs::path dir = _root / name;
+        fs::create_directories(dir);
+
+        std::vector<ADTConversionJob> jobs;
+        for (uint32 tile = 0; tile < TEST_TILES; ++tile)
+            jobs.push_back({ "World\\Maps\\Test\\Test_" + std::to_string(tile) + ".adt", (dir / (std::to_string(tile) + ".map")).string() });
+
+        if (reversed)
+            std::reverse(jobs.begin(), jobs.end());
+
+        ConvertADTs(jobs, TEST_BUILD, threads, [] { }, [] { });
+        return dir;
+    }
+
+    fs::path _root;
+};
+
+// cppcheck-suppress syntaxError
+TEST_F(MapConverterTest, ThreadedOutputMatchesSingleThread)
+{
+    auto single = ReadOutput(Convert("single", 1, false));
+    auto threaded = ReadOutput(Convert("threaded", 4, false));
+
+    ASSERT_EQ(single.size(), TEST_TILES);
+    ASSERT_EQ(threaded.size(), TEST_TILES);
+
+    for (auto const& [name, content] : single)
+    {
+        ASSERT_GE(content.size(), 4u);
+        EXPECT_EQ(std::string(content.data(), 4), "MAPS") << name;
+        EXPECT_EQ(threaded[name], content) << name;
+    }
+}
+
+TEST_F(MapConverterTest, OutputDoesNotDependOnTileOrder)
+{
+    auto forward = ReadOutput(Convert("forward", 1, false));
+    auto reversed = ReadOutput(Convert("reversed", 1, true));
+
+    ASSERT_EQ(forward.size(), TEST_TILES);
+    EXPECT_EQ(forward, reversed);
+}
+
+} // namespace
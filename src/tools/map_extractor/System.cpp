@@ -22,6 +22,7 @@
 #include <deque>
 #include <filesystem>
 #include <set>
+#include <thread>
 #include <unordered_map>
 #include <cstring>
 
@@ -33,6 +34,7 @@
 #endif
 
 #include "dbcfile.h"
+#include "mapconverter.h"
 #include "mpq_libmpq04.h"
 #include "StringFormat.h"
 
@@ -56,7 +58,7 @@
 #else
 #define OPEN_FLAGS (O_RDONLY | O_BINARY)
 #endif
-extern ArchiveSet gOpenArchives;
+extern thread_local ArchiveSet gOpenArchives;
 
 // cppcheck-suppress ctuOneDefinitionRuleViolation
 typedef struct
@@ -65,13 +67,7 @@ typedef struct
     uint32 id;
 } map_id;
 
-struct LiquidTypeEntry
-{
-    uint8 SoundBank;
-};
-
 std::vector<map_id> map_ids;
-std::unordered_map<uint32, LiquidTypeEntry> LiquidTypes;
 #define MAX_PATH_LENGTH 128
 char output_path[MAX_PATH_LENGTH] = ".";
 char input_path[MAX_PATH_LENGTH] = ".";
@@ -88,16 +84,8 @@ enum Extract
 
 // Select data for extract
 int   CONF_extract = EXTRACT_MAP | EXTRACT_DBC | EXTRACT_CAMERA;
-// This option allow limit minimum height to some value (Allow save some memory)
-bool  CONF_allow_height_limit = true;
-float CONF_use_minHeight = -500.0f;
-
-// This option allow use float to int conversion
-bool  CONF_allow_float_to_int   = true;
-float CONF_float_to_int8_limit  = 2.0f;      // Max accuracy = val/256
-float CONF_float_to_int16_limit = 2048.0f;   // Max accuracy = val/65536
-float CONF_flat_height_delta_limit = 0.005f; // If max - min less this value - surface is flat
-float CONF_flat_liquid_delta_limit = 0.001f; // If max - min less this value - liquid surface is flat
+// Number of threads converting adt files
+uint32 CONF_threads = std::thread::hardware_concurrency();
 
 // List MPQ for extract from
 const char* CONF_mpq_list[] =
@@ -162,6 +150,7 @@ void Usage(char* prg)
         "-o set output path\n"\
         "-e extract only MAP(1)/DBC(2)/Camera(4) - standard: all(7)\n"\
         "-f height stored as int (less map size but lost some accuracy) 1 by default\n"\
+        "-t number of threads converting map files, all cores by default\n"\
         "Example: %s -f 0 -i \"c:\\games\\game\"", prg, prg);
     exit(1);
 }
@@ -175,6 +164,7 @@ void HandleArgs(int argc, char* arg[])
         // e - extract only MAP(1)/DBC(2) - standard both(3)
         // f - use float to int conversion
         // h - limit minimum height
+        // t - number of threads
         if (arg[c][0] != '-')
         {
             Usage(arg[0]);
@@ -214,6 +204,16 @@ void HandleArgs(int argc, char* arg[])
                     Usage(arg[0]);
                 }
                 break;
+            case 't':
+                if (c + 1 < argc)                           // all ok
+                {
+                    CONF_threads = atoi(arg[(c++) + 1]);
+                }
+                else
+                {
+                    Usage(arg[0]);
+                }
+                break;
             case 'e':
                 if (c + 1 < argc)                           // all ok
                 {
@@ -304,679 +304,19 @@ void ReadLiquidTypeTableDBC()
 
     for (uint32 x = 0; x < dbc.getRecordCount(); ++x)
     {
-        LiquidTypeEntry& liquidType = LiquidTypes[dbc.getRecord(x).getUInt(0)];
+        LiquidTypeInfo& liquidType = LiquidTypes[dbc.getRecord(x).getUInt(0)];
         liquidType.SoundBank = dbc.getRecord(x).getUInt(3);
     }
 
     printf("Done! (%lu LiquidTypes loaded)\n", LiquidTypes.size());
 }
 
-//
-// Adt file convertor function and data
-//
-
-// Map file format data
-static char const* MAP_MAGIC         = "MAPS";
-static uint32 const MAP_VERSION_MAGIC = 9;
-static char const* MAP_AREA_MAGIC    = "AREA";
-static char const* MAP_HEIGHT_MAGIC  = "MHGT";
-static char const* MAP_LIQUID_MAGIC  = "MLIQ";
-
-struct map_fileheader
-{
-    uint32 mapMagic;
-    uint32 versionMagic;
-    uint32 buildMagic;
-    uint32 areaMapOffset;
-    uint32 areaMapSize;
-    uint32 heightMapOffset;
-    uint32 heightMapSize;
-    uint32 liquidMapOffset;
-    uint32 liquidMapSize;
-    uint32 holesOffset;
-    uint32 holesSize;
-};
-
-#define MAP_AREA_NO_AREA      0x0001
-
-struct map_areaHeader
-{
-    uint32 fourcc;
-    uint16 flags;
-    uint16 gridArea;
-};
-
-#define MAP_HEIGHT_NO_HEIGHT            0x0001
-#define MAP_HEIGHT_AS_INT16             0x0002
-#define MAP_HEIGHT_AS_INT8              0x0004
-#define MAP_HEIGHT_HAS_FLIGHT_BOUNDS    0x0008
-
-struct map_heightHeader
-{
-    uint32 fourcc;
-    uint32 flags;
-    float  gridHeight;
-    float  gridMaxHeight;
-};
-
-#define MAP_LIQUID_TYPE_NO_WATER    0x00
-#define MAP_LIQUID_TYPE_WATER       0x01
-#define MAP_LIQUID_TYPE_OCEAN       0x02
-#define MAP_LIQUID_TYPE_MAGMA       0x04
-#define MAP_LIQUID_TYPE_SLIME       0x08
-
-#define MAP_LIQUID_TYPE_DARK_WATER  0x10
-
-#define MAP_LIQUID_NO_TYPE    0x0001
-#define MAP_LIQUID_NO_HEIGHT  0x0002
-
-struct map_liquidHeader
-{
-    uint32 fourcc;
-    uint8 flags;
-    uint8 liquidFlags;
-    uint16 liquidType;
-    uint8  offsetX;
-    uint8  offsetY;
-    uint8  width;
-    uint8  height;
-    float  liquidLevel;
-};
-
-float selectUInt8StepStore(float maxDiff)
-{
-    return 255 / maxDiff;
-}
-
-float selectUInt16StepStore(float maxDiff)
-{
-    return 65535 / maxDiff;
-}
-// Temporary grid data store
-uint16 area_ids[ADT_CELLS_PER_GRID][ADT_CELLS_PER_GRID];
-
-float V8[ADT_GRID_SIZE][ADT_GRID_SIZE];
-float V9[ADT_GRID_SIZE + 1][ADT_GRID_SIZE + 1];
-uint16 uint16_V8[ADT_GRID_SIZE][ADT_GRID_SIZE];
-uint16 uint16_V9[ADT_GRID_SIZE + 1][ADT_GRID_SIZE + 1];
-uint8  uint8_V8[ADT_GRID_SIZE][ADT_GRID_SIZE];
-uint8  uint8_V9[ADT_GRID_SIZE + 1][ADT_GRID_SIZE + 1];
-
-uint16 liquid_entry[ADT_CELLS_PER_GRID][ADT_CELLS_PER_GRID];
-uint8 liquid_flags[ADT_CELLS_PER_GRID][ADT_CELLS_PER_GRID];
-bool  liquid_show[ADT_GRID_SIZE][ADT_GRID_SIZE];
-float liquid_height[ADT_GRID_SIZE + 1][ADT_GRID_SIZE + 1];
-uint16 holes[ADT_CELLS_PER_GRID][ADT_CELLS_PER_GRID];
-
-int16 flight_box_max[3][3];
-int16 flight_box_min[3][3];
-
-bool ConvertADT(std::string const& inputPath, std::string const& outputPath, int /*cell_y*/, int /*cell_x*/, uint32 build)
-{
-    ADT_file adt;
-
-    if (!adt.loadFile(inputPath))
-        return false;
-
-    adt_MCIN* cells = adt.a_grid->getMCIN();
-    if (!cells)
-    {
-        printf("Can't find cells in '%s'\n", inputPath.c_str());
-        return false;
-    }
-
-    memset(liquid_show, 0, sizeof(liquid_show));
-    memset(liquid_flags, 0, sizeof(liquid_flags));
-    memset(liquid_entry, 0, sizeof(liquid_entry));
-
-    memset(holes, 0, sizeof(holes));
-
-    // Prepare map header
-    map_fileheader map;
-    map.mapMagic = *reinterpret_cast<uint32 const*>(MAP_MAGIC);
-    map.versionMagic = MAP_VERSION_MAGIC;
-    map.buildMagic = build;
-
-    // Get area flags data
-    for (int i = 0; i < ADT_CELLS_PER_GRID; i++)
-        for (int j = 0; j < ADT_CELLS_PER_GRID; j++)
-            area_ids[i][j] = cells->getMCNK(i, j)->areaid;
-
-    //============================================
-    // Try pack area data
-    //============================================
-    bool fullAreaData = false;
-    uint32 areaId = area_ids[0][0];
-    for (auto & area_id : area_ids)
-    {
-        for (int x = 0; x < ADT_CELLS_PER_GRID; ++x)
-        {
-            if (area_id[x] != areaId)
-            {
-                fullAreaData = true;
-                break;
-            }
-        }
-    }
-
-    map.areaMapOffset = sizeof(map);
-    map.areaMapSize   = sizeof(map_areaHeader);
-
-    map_areaHeader areaHeader;
-    areaHeader.fourcc = *reinterpret_cast<uint32 const*>(MAP_AREA_MAGIC);
-    areaHeader.flags = 0;
-    if (fullAreaData)
-    {
-        areaHeader.gridArea = 0;
-        map.areaMapSize += sizeof(area_ids);
-    }
-    else
-    {
-        areaHeader.flags |= MAP_AREA_NO_AREA;
-        areaHeader.gridArea = static_cast<uint16>(areaId);
-    }
-
-    //
-    // Get Height map from grid
-    //
-    for (int i = 0; i < ADT_CELLS_PER_GRID; i++)
-    {
-        for (int j = 0; j < ADT_CELLS_PER_GRID; j++)
-        {
-            adt_MCNK* cell = cells->getMCNK(i, j);
-            if (!cell)
-                continue;
-            // Height values for triangles stored in order:
-            // 1     2     3     4     5     6     7     8     9
-            //    10    11    12    13    14    15    16    17
-            // 18    19    20    21    22    23    24    25    26
-            //    27    28    29    30    31    32    33    34
-            // . . . . . . . .
-            // For better get height values merge it to V9 and V8 map
-            // V9 height map:
-            // 1     2     3     4     5     6     7     8     9
-            // 18    19    20    21    22    23    24    25    26
-            // . . . . . . . .
-            // V8 height map:
-            //    10    11    12    13    14    15    16    17
-            //    27    28    29    30    31    32    33    34
-            // . . . . . . . .
-
-            // Set map height as grid height
-            for (int y = 0; y <= ADT_CELL_SIZE; y++)
-            {
-                int cy = i * ADT_CELL_SIZE + y;
-                for (int x = 0; x <= ADT_CELL_SIZE; x++)
-                {
-                    int cx = j * ADT_CELL_SIZE + x;
-                    V9[cy][cx] = cell->ypos;
-                }
-            }
-            for (int y = 0; y < ADT_CELL_SIZE; y++)
-            {
-                int cy = i * ADT_CELL_SIZE + y;
-                for (int x = 0; x < ADT_CELL_SIZE; x++)
-                {
-                    int cx = j * ADT_CELL_SIZE + x;
-                    V8[cy][cx] = cell->ypos;
-                }
-            }
-            // Get custom height
-            adt_MCVT* v = cell->getMCVT();
-            if (!v)
-                continue;
-            // get V9 height map
-            for (int y = 0; y <= ADT_CELL_SIZE; y++)
-            {
-                int cy = i * ADT_CELL_SIZE + y;
-                for (int x = 0; x <= ADT_CELL_SIZE; x++)
-                {
-                    int cx = j * ADT_CELL_SIZE + x;
-                    V9[cy][cx] += v->height_map[y * (ADT_CELL_SIZE * 2 + 1) + x];
-                }
-            }
-            // get V8 height map
-            for (int y = 0; y < ADT_CELL_SIZE; y++)
-            {
-                int cy = i * ADT_CELL_SIZE + y;
-                for (int x = 0; x < ADT_CELL_SIZE; x++)
-                {
-                    int cx = j * ADT_CELL_SIZE + x;
-                    V8[cy][cx] += v->height_map[y * (ADT_CELL_SIZE * 2 + 1) + ADT_CELL_SIZE + 1 + x];
-                }
-            }
-        }
-    }
-    //============================================
-    // Try pack height data
-    //============================================
-    float maxHeight = -20000;
-    float minHeight =  20000;
-    for (auto & y : V8)
-    {
-        for (int x = 0; x < ADT_GRID_SIZE; x++)
-        {
-            float h = y[x];
-            if (maxHeight < h) maxHeight = h;
-            if (minHeight > h) minHeight = h;
-        }
-    }
-    for (int y = 0; y <= ADT_GRID_SIZE; y++)
-    {
-        for (int x = 0; x <= ADT_GRID_SIZE; x++)
-        {
-            float h = V9[y][x];
-            if (maxHeight < h) maxHeight = h;
-            if (minHeight > h) minHeight = h;
-        }
-    }
-
-    // Check for allow limit minimum height (not store height in deep ochean - allow save some memory)
-    if (CONF_allow_height_limit && minHeight < CONF_use_minHeight)
-    {
-        for (auto & y : V8)
-            for (int x = 0; x < ADT_GRID_SIZE; x++)
-                if (y[x] < CONF_use_minHeight)
-                    y[x] = CONF_use_minHeight;
-        for (int y = 0; y <= ADT_GRID_SIZE; y++)
-            for (int x = 0; x <= ADT_GRID_SIZE; x++)
-                if (V9[y][x] < CONF_use_minHeight)
-                    V9[y][x] = CONF_use_minHeight;
-        if (minHeight < CONF_use_minHeight)
-            minHeight = CONF_use_minHeight;
-        if (maxHeight < CONF_use_minHeight)
-            maxHeight = CONF_use_minHeight;
-    }
-
-    bool hasFlightBox = false;
-    if (adt_MFBO* mfbo = adt.a_grid->getMFBO())
-    {
-        memcpy(flight_box_max, &mfbo->max, sizeof(flight_box_max));
-        memcpy(flight_box_min, &mfbo->min, sizeof(flight_box_min));
-        hasFlightBox = true;
-    }
-
-    map.heightMapOffset = map.areaMapOffset + map.areaMapSize;
-    map.heightMapSize = sizeof(map_heightHeader);
-
-    map_heightHeader heightHeader;
-    heightHeader.fourcc = *reinterpret_cast<uint32 const*>(MAP_HEIGHT_MAGIC);
-    heightHeader.flags = 0;
-    heightHeader.gridHeight    = minHeight;
-    heightHeader.gridMaxHeight = maxHeight;
-
-    if (maxHeight == minHeight)
-        heightHeader.flags |= MAP_HEIGHT_NO_HEIGHT;
-
-    // Not need store if flat surface
-    if (CONF_allow_float_to_int && (maxHeight - minHeight) < CONF_flat_height_delta_limit)
-        heightHeader.flags |= MAP_HEIGHT_NO_HEIGHT;
-
-    if (hasFlightBox)
-    {
-        heightHeader.flags |= MAP_HEIGHT_HAS_FLIGHT_BOUNDS;
-        map.heightMapSize += sizeof(flight_box_max) + sizeof(flight_box_min);
-    }
-
-    // Try store as packed in uint16 or uint8 values
-    if (!(heightHeader.flags & MAP_HEIGHT_NO_HEIGHT))
-    {
-        float step = 0;
-        // Try Store as uint values
-        if (CONF_allow_float_to_int)
-        {
-            float diff = maxHeight - minHeight;
-            if (diff < CONF_float_to_int8_limit)      // As uint8 (max accuracy = CONF_float_to_int8_limit/256)
-            {
-                heightHeader.flags |= MAP_HEIGHT_AS_INT8;
-                step = selectUInt8StepStore(diff);
-            }
-            else if (diff < CONF_float_to_int16_limit) // As uint16 (max accuracy = CONF_float_to_int16_limit/65536)
-            {
-                heightHeader.flags |= MAP_HEIGHT_AS_INT16;
-                step = selectUInt16StepStore(diff);
-            }
-        }
-
-        // Pack it to int values if need
-        if (heightHeader.flags & MAP_HEIGHT_AS_INT8)
-        {
-            for (int y = 0; y < ADT_GRID_SIZE; y++)
-                for (int x = 0; x < ADT_GRID_SIZE; x++)
-                    uint8_V8[y][x] = uint8((V8[y][x] - minHeight) * step + 0.5f);
-            for (int y = 0; y <= ADT_GRID_SIZE; y++)
-                for (int x = 0; x <= ADT_GRID_SIZE; x++)
-                    uint8_V9[y][x] = uint8((V9[y][x] - minHeight) * step + 0.5f);
-            map.heightMapSize += sizeof(uint8_V9) + sizeof(uint8_V8);
-        }
-        else if (heightHeader.flags & MAP_HEIGHT_AS_INT16)
-        {
-            for (int y = 0; y < ADT_GRID_SIZE; y++)
-                for (int x = 0; x < ADT_GRID_SIZE; x++)
-                    uint16_V8[y][x] = uint16((V8[y][x] - minHeight) * step + 0.5f);
-            for (int y = 0; y <= ADT_GRID_SIZE; y++)
-                for (int x = 0; x <= ADT_GRID_SIZE; x++)
-                    uint16_V9[y][x] = uint16((V9[y][x] - minHeight) * step + 0.5f);
-            map.heightMapSize += sizeof(uint16_V9) + sizeof(uint16_V8);
-        }
-        else
-            map.heightMapSize += sizeof(V9) + sizeof(V8);
-    }
-
-    // Get from MCLQ chunk (old)
-    for (int i = 0; i < ADT_CELLS_PER_GRID; i++)
-    {
-        for (int j = 0; j < ADT_CELLS_PER_GRID; j++)
-        {
-            adt_MCNK* cell = cells->getMCNK(i, j);
-            if (!cell)
-                continue;
-
-            adt_MCLQ* liquid = cell->getMCLQ();
-            int count = 0;
-            if (!liquid || cell->sizeMCLQ <= 8)
-                continue;
-
-            for (int y = 0; y < ADT_CELL_SIZE; y++)
-            {
-                int cy = i * ADT_CELL_SIZE + y;
-                for (int x = 0; x < ADT_CELL_SIZE; x++)
-                {
-                    int cx = j * ADT_CELL_SIZE + x;
-                    if (liquid->flags[y][x] != 0x0F)
-                    {
-                        liquid_show[cy][cx] = true;
-                        if (liquid->flags[y][x] & (1 << 7))
-                            liquid_flags[i][j] |= MAP_LIQUID_TYPE_DARK_WATER;
-                        ++count;
-                    }
-                }
-            }
-
-            uint32 c_flag = cell->flags;
-            if (c_flag & (1 << 2))
-            {
-                liquid_entry[i][j] = 1;
-                liquid_flags[i][j] |= MAP_LIQUID_TYPE_WATER;            // water
-            }
-            if (c_flag & (1 << 3))
-            {
-                liquid_entry[i][j] = 2;
-                liquid_flags[i][j] |= MAP_LIQUID_TYPE_OCEAN;            // ocean
-            }
-            if (c_flag & (1 << 4))
-            {
-                liquid_entry[i][j] = 3;
-                liquid_flags[i][j] |= MAP_LIQUID_TYPE_MAGMA;            // magma/slime
-            }
-
-            if (!count && liquid_flags[i][j])
-                fprintf(stderr, "Wrong liquid detect in MCLQ chunk");
-
-            for (int y = 0; y <= ADT_CELL_SIZE; y++)
-            {
-                int cy = i * ADT_CELL_SIZE + y;
-                for (int x = 0; x <= ADT_CELL_SIZE; x++)
-                {
-                    int cx = j * ADT_CELL_SIZE + x;
-                    liquid_height[cy][cx] = liquid->liquid[y][x].height;
-                }
-            }
-        }
-    }
-
-    // Get liquid map for grid (in WOTLK used MH2O chunk)
-    adt_MH2O* h2o = adt.a_grid->getMH2O();
-    if (h2o)
-    {
-        for (int32 i = 0; i < ADT_CELLS_PER_GRID; i++)
-        {
-            for (int32 j = 0; j < ADT_CELLS_PER_GRID; j++)
-            {
-                adt_liquid_instance const* h = h2o->GetLiquidInstance(i,j);
-                if (!h)
-                    continue;
-
-                adt_liquid_attributes attrs = h2o->GetLiquidAttributes(i, j);
-
-                int32 count = 0;
-                uint64 existsMask = h2o->GetLiquidExistsBitmap(h);
-                for (int32 y = 0; y < h->GetHeight(); y++)
-                {
-                    int32 cy = i * ADT_CELL_SIZE + y + h->GetOffsetY();
-                    for (int32 x = 0; x < h->GetWidth(); x++)
-                    {
-                        int32 cx = j * ADT_CELL_SIZE + x + h->GetOffsetX();
-                        if (existsMask & 1)
-                        {
-                            liquid_show[cy][cx] = true;
-                            ++count;
-                        }
-                        existsMask >>= 1;
-                    }
-                }
-
-                liquid_entry[i][j] = h->LiquidType;
-                switch (LiquidTypes.at(h->LiquidType).SoundBank)
-                {
-                    case LIQUID_TYPE_WATER: liquid_flags[i][j] |= MAP_LIQUID_TYPE_WATER; break;
-                    case LIQUID_TYPE_OCEAN: liquid_flags[i][j] |= MAP_LIQUID_TYPE_OCEAN; if (attrs.Deep) liquid_flags[i][j] |= MAP_LIQUID_TYPE_DARK_WATER; break;
-                    case LIQUID_TYPE_MAGMA: liquid_flags[i][j] |= MAP_LIQUID_TYPE_MAGMA; break;
-                    case LIQUID_TYPE_SLIME: liquid_flags[i][j] |= MAP_LIQUID_TYPE_SLIME; break;
-                    default:
-                        printf("\nCan't find Liquid type %u for map %s\nchunk %d,%d\n", h->LiquidType, inputPath.c_str(), i, j);
-                        break;
-                }
-
-                if (!count && liquid_flags[i][j])
-                    printf("Wrong liquid detect in MH2O chunk");
-
-                int32 pos = 0;
-                for (int32 y = 0; y <= h->GetHeight(); y++)
-                {
-                    int cy = i * ADT_CELL_SIZE + y + h->GetOffsetY();
-                    for (int32 x = 0; x <= h->GetWidth(); x++)
-                    {
-                        int32 cx = j * ADT_CELL_SIZE + x + h->GetOffsetX();
-                        liquid_height[cy][cx] = h2o->GetLiquidHeight(h, pos);
-
-                        pos++;
-                    }
-                }
-            }
-        }
-    }
-    //============================================
-    // Pack liquid data
-    //============================================
-    uint16 firstLiquidType = liquid_entry[0][0];
-    uint8 firstLiquidFlag = liquid_flags[0][0];
-    bool fullType = false;
-    for (int y = 0; y < ADT_CELLS_PER_GRID; y++)
-    {
-        for (int x = 0; x < ADT_CELLS_PER_GRID; x++)
-        {
-            if (liquid_entry[y][x] != firstLiquidType || liquid_flags[y][x] != firstLiquidFlag)
-            {
-                fullType = true;
-                y = ADT_CELLS_PER_GRID;
-                break;
-            }
-        }
-    }
-
-    map_liquidHeader liquidHeader;
-
-    // no water data (if all grid have 0 liquid type)
-    if (firstLiquidFlag == 0 && !fullType)
-    {
-        // No liquid data
-        map.liquidMapOffset = 0;
-        map.liquidMapSize   = 0;
-    }
-    else
-    {
-        int minX = 255, minY = 255;
-        int maxX = 0, maxY = 0;
-        maxHeight = -20000;
-        minHeight = 20000;
-        for (int y = 0; y < ADT_GRID_SIZE; y++)
-        {
-            for (int x = 0; x < ADT_GRID_SIZE; x++)
-            {
-                if (liquid_show[y][x])
-                {
-                    if (minX > x) minX = x;
-                    if (maxX < x) maxX = x;
-                    if (minY > y) minY = y;
-                    if (maxY < y) maxY = y;
-                    float h = liquid_height[y][x];
-                    if (maxHeight < h) maxHeight = h;
-                    if (minHeight > h) minHeight = h;
-                }
-                else
-                {
-                    liquid_height[y][x] = CONF_use_minHeight;
-
-                    if (minHeight > CONF_use_minHeight)
-                    {
-                        minHeight = CONF_use_minHeight;
-                    }
-                }
-            }
-        }
-        map.liquidMapOffset = map.heightMapOffset + map.heightMapSize;
-        map.liquidMapSize = sizeof(map_liquidHeader);
-        liquidHeader.fourcc = *(uint32 const*)MAP_LIQUID_MAGIC;
-        liquidHeader.flags = 0;
-        liquidHeader.liquidType = 0;
-        liquidHeader.offsetX = minX;
-        liquidHeader.offsetY = minY;
-        liquidHeader.width   = maxX - minX + 1 + 1;
-        liquidHeader.height  = maxY - minY + 1 + 1;
-        liquidHeader.liquidLevel = minHeight;
-
-        if (maxHeight == minHeight)
-            liquidHeader.flags |= MAP_LIQUID_NO_HEIGHT;
-
-        // Not need store if flat surface
-        if (CONF_allow_float_to_int && (maxHeight - minHeight) < CONF_flat_liquid_delta_limit)
-            liquidHeader.flags |= MAP_LIQUID_NO_HEIGHT;
-
-        if (!fullType)
-            liquidHeader.flags |= MAP_LIQUID_NO_TYPE;
-
-        if (liquidHeader.flags & MAP_LIQUID_NO_TYPE)
-        {
-            liquidHeader.liquidFlags = firstLiquidFlag;
-            liquidHeader.liquidType = firstLiquidType;
-        }
-        else
-            map.liquidMapSize += sizeof(liquid_entry) + sizeof(liquid_flags);
-
-        if (!(liquidHeader.flags & MAP_LIQUID_NO_HEIGHT))
-            map.liquidMapSize += sizeof(float) * liquidHeader.width * liquidHeader.height;
-    }
-
-    bool hasHoles = false;
+void LoadLocaleMPQFiles(int const locale);
+void LoadCommonMPQFiles();
+inline void CloseMPQFiles();
 
-    for (int i = 0; i < ADT_CELLS_PER_GRID; ++i)
-    {
-        for (int j = 0; j < ADT_CELLS_PER_GRID; ++j)
-        {
-            adt_MCNK* cell = cells->getMCNK(i, j);
-            if (!cell)
-                continue;
-            holes[i][j] = cell->holes;
-            if (!hasHoles && cell->holes != 0)
-                hasHoles = true;
-        }
-    }
-
-    if (hasHoles)
-    {
-        if (map.liquidMapOffset)
-            map.holesOffset = map.liquidMapOffset + map.liquidMapSize;
-        else
-            map.holesOffset = map.heightMapOffset + map.heightMapSize;
-
-        map.holesSize = sizeof(holes);
-    }
-    else
-    {
-        map.holesOffset = 0;
-        map.holesSize = 0;
-    }
-
-    // Ok all data prepared - store it
-    FILE* output = fopen(outputPath.c_str(), "wb");
-    if (!output)
-    {
-        printf("Can't create the output file '%s'\n", outputPath.c_str());
-        return false;
-    }
-    fwrite(&map, sizeof(map), 1, output);
-    // Store area data
-    fwrite(&areaHeader, sizeof(areaHeader), 1, output);
-    if (!(areaHeader.flags & MAP_AREA_NO_AREA))
-        fwrite(area_ids, sizeof(area_ids), 1, output);
-
-    // Store height data
-    fwrite(&heightHeader, sizeof(heightHeader), 1, output);
-    if (!(heightHeader.flags & MAP_HEIGHT_NO_HEIGHT))
-    {
-        if (heightHeader.flags & MAP_HEIGHT_AS_INT16)
-        {
-            fwrite(uint16_V9, sizeof(uint16_V9), 1, output);
-            fwrite(uint16_V8, sizeof(uint16_V8), 1, output);
-        }
-        else if (heightHeader.flags & MAP_HEIGHT_AS_INT8)
-        {
-            fwrite(uint8_V9, sizeof(uint8_V9), 1, output);
-            fwrite(uint8_V8, sizeof(uint8_V8), 1, output);
-        }
-        else
-        {
-            fwrite(V9, sizeof(V9), 1, output);
-            fwrite(V8, sizeof(V8), 1, output);
-        }
-    }
-
-    if (heightHeader.flags & MAP_HEIGHT_HAS_FLIGHT_BOUNDS)
-    {
-        fwrite(flight_box_max, sizeof(flight_box_max), 1, output);
-        fwrite(flight_box_min, sizeof(flight_box_min), 1, output);
-    }
-
-    // Store liquid data if need
-    if (map.liquidMapOffset)
-    {
-        fwrite(&liquidHeader, sizeof(liquidHeader), 1, output);
-        if (!(liquidHeader.flags & MAP_LIQUID_NO_TYPE))
-        {
-            fwrite(liquid_entry, sizeof(liquid_entry), 1, output);
-            fwrite(liquid_flags, sizeof(liquid_flags), 1, output);
-        }
-        if (!(liquidHeader.flags & MAP_LIQUID_NO_HEIGHT))
-        {
-            for (int y = 0; y < liquidHeader.height; y++)
-                fwrite(&liquid_height[y + liquidHeader.offsetY][liquidHeader.offsetX], sizeof(float), liquidHeader.width, output);
-        }
-    }
-
-    // store hole data
-    if (hasHoles)
-        fwrite(holes, map.holesSize, 1, output);
-
-    fclose(output);
-
-    return true;
-}
-
-void ExtractMapsFromMpq(uint32 build)
+void ExtractMapsFromMpq(uint32 build, int locale)
 {
-    std::string mpqFileName;
-    std::string outputFileName;
     std::string mpqMapName;
 
     printf("Extracting maps...\n");
@@ -989,10 +329,9 @@ void ExtractMapsFromMpq(uint32 build)
     path += "/maps/";
     CreateDir(path);
 
-    printf("Convert map files\n");
+    std::vector<ADTConversionJob> jobs;
     for (uint32 z = 0; z < map_count; ++z)
     {
-        printf("Extract %s (%d/%u)                  \n", map_ids[z].name, z + 1, map_count);
         // Loadup map grid data
         mpqMapName = Acore::StringFormat(R"(World\Maps\{}\{}.wdt)", map_ids[z].name, map_ids[z].name);
         WDT_file wdt;
@@ -1008,14 +347,19 @@ void ExtractMapsFromMpq(uint32 build)
             {
                 if (!wdt.main->adt_list[y][x].exist)
                     continue;
-                mpqFileName = Acore::StringFormat(R"(World\Maps\{}\{}_{}_{}.adt)", map_ids[z].name, map_ids[z].name, x, y);
-                outputFileName = Acore::StringFormat("{}/maps/{:03}{:02}{:02}.map", output_path, map_ids[z].id, y, x);
-                ConvertADT(mpqFileName, outputFileName, y, x, build);
+
+                jobs.push_back({ Acore::StringFormat(R"(World\Maps\{}\{}_{}_{}.adt)", map_ids[z].name, map_ids[z].name, x, y),
+                    Acore::StringFormat("{}/maps/{:03}{:02}{:02}.map", output_path, map_ids[z].id, y, x) });
             }
-            // draw progress bar
-            printf("Processing........................%d%%\r", (100 * (y + 1)) / WDT_MAP_SIZE);
         }
     }
+
+    printf("Convert %u map files\n", uint32(jobs.size()));
+    ConvertADTs(jobs, build, CONF_threads, [locale]()
+    {
+        LoadLocaleMPQFiles(locale);
+        LoadCommonMPQFiles();
+    }, CloseMPQFiles);
     printf("\n");
 }
 
@@ -1251,7 +595,7 @@ int main(int argc, char* arg[])
         LoadCommonMPQFiles();
 
         // Extract maps
-        ExtractMapsFromMpq(build);
+        ExtractMapsFromMpq(build, FirstLocale);
 
         // Close MPQs
         CloseMPQFiles();
@@ -0,0 +1,761 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "mapconverter.h"
+#include "adt.h"
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <thread>
+
+std::unordered_map<uint32, LiquidTypeInfo> LiquidTypes;
+
+// This option allow limit minimum height to some value (Allow save some memory)
+bool  CONF_allow_height_limit = true;
+float CONF_use_minHeight = -500.0f;
+
+// This option allow use float to int conversion
+bool  CONF_allow_float_to_int   = true;
+float CONF_float_to_int8_limit  = 2.0f;      // Max accuracy = val/256
+float CONF_float_to_int16_limit = 2048.0f;   // Max accuracy = val/65536
+float CONF_flat_height_delta_limit = 0.005f; // If max - min less this value - surface is flat
+float CONF_flat_liquid_delta_limit = 0.001f; // If max - min less this value - liquid surface is flat
+
+namespace
+{
+//
+// Adt file convertor function and data
+//
+
+// Map file format data
+static char const* MAP_MAGIC         = "MAPS";
+static uint32 const MAP_VERSION_MAGIC = 9;
+static char const* MAP_AREA_MAGIC    = "AREA";
+static char const* MAP_HEIGHT_MAGIC  = "MHGT";
+static char const* MAP_LIQUID_MAGIC  = "MLIQ";
+
+struct map_fileheader
+{
+    uint32 mapMagic;
+    uint32 versionMagic;
+    uint32 buildMagic;
+    uint32 areaMapOffset;
+    uint32 areaMapSize;
+    uint32 heightMapOffset;
+    uint32 heightMapSize;
+    uint32 liquidMapOffset;
+    uint32 liquidMapSize;
+    uint32 holesOffset;
+    uint32 holesSize;
+};
+
+#define MAP_AREA_NO_AREA      0x0001
+
+struct map_areaHeader
+{
+    uint32 fourcc;
+    uint16 flags;
+    uint16 gridArea;
+};
+
+#define MAP_HEIGHT_NO_HEIGHT            0x0001
+#define MAP_HEIGHT_AS_INT16             0x0002
+#define MAP_HEIGHT_AS_INT8              0x0004
+#define MAP_HEIGHT_HAS_FLIGHT_BOUNDS    0x0008
+
+struct map_heightHeader
+{
+    uint32 fourcc;
+    uint32 flags;
+    float  gridHeight;
+    float  gridMaxHeight;
+};
+
+#define MAP_LIQUID_TYPE_NO_WATER    0x00
+#define MAP_LIQUID_TYPE_WATER       0x01
+#define MAP_LIQUID_TYPE_OCEAN       0x02
+#define MAP_LIQUID_TYPE_MAGMA       0x04
+#define MAP_LIQUID_TYPE_SLIME       0x08
+
+#define MAP_LIQUID_TYPE_DARK_WATER  0x10
+
+#define MAP_LIQUID_NO_TYPE    0x0001
+#define MAP_LIQUID_NO_HEIGHT  0x0002
+
+struct map_liquidHeader
+{
+    uint32 fourcc;
+    uint8 flags;
+    uint8 liquidFlags;
+    uint16 liquidType;
+    uint8  offsetX;
+    uint8  offsetY;
+    uint8  width;
+    uint8  height;
+    float  liquidLevel;
+};
+
+float selectUInt8StepStore(float maxDiff)
+{
+    return 255 / maxDiff;
+}
+
+float selectUInt16StepStore(float maxDiff)
+{
+    return 65535 / maxDiff;
+}
+// Temporary grid data store, each conversion thread has its own
+thread_local uint16 area_ids[ADT_CELLS_PER_GRID][ADT_CELLS_PER_GRID];
+
+thread_local float V8[ADT_GRID_SIZE][ADT_GRID_SIZE];
+thread_local float V9[ADT_GRID_SIZE + 1][ADT_GRID_SIZE + 1];
+thread_local uint16 uint16_V8[ADT_GRID_SIZE][ADT_GRID_SIZE];
+thread_local uint16 uint16_V9[ADT_GRID_SIZE + 1][ADT_GRID_SIZE + 1];
+thread_local uint8  uint8_V8[ADT_GRID_SIZE][ADT_GRID_SIZE];
+thread_local uint8  uint8_V9[ADT_GRID_SIZE + 1][ADT_GRID_SIZE + 1];
+
+thread_local uint16 liquid_entry[ADT_CELLS_PER_GRID][ADT_CELLS_PER_GRID];
+thread_local uint8 liquid_flags[ADT_CELLS_PER_GRID][ADT_CELLS_PER_GRID];
+thread_local bool  liquid_show[ADT_GRID_SIZE][ADT_GRID_SIZE];
+thread_local float liquid_height[ADT_GRID_SIZE + 1][ADT_GRID_SIZE + 1];
+thread_local uint16 holes[ADT_CELLS_PER_GRID][ADT_CELLS_PER_GRID];
+
+thread_local int16 flight_box_max[3][3];
+thread_local int16 flight_box_min[3][3];
+}
+
+bool ConvertADT(std::string const& inputPath, std::string const& outputPath, uint32 build)
+{
+    ADT_file adt;
+
+    if (!adt.loadFile(inputPath))
+        return false;
+
+    adt_MCIN* cells = adt.a_grid->getMCIN();
+    if (!cells)
+    {
+        printf("Can't find cells in '%s'\n", inputPath.c_str());
+        return false;
+    }
+
+    // start from clean buffers, cells missing in this tile must not keep data of the tile converted before
+    memset(V8, 0, sizeof(V8));
+    memset(V9, 0, sizeof(V9));
+    memset(liquid_show, 0, sizeof(liquid_show));
+    memset(liquid_flags, 0, sizeof(liquid_flags));
+    memset(liquid_entry, 0, sizeof(liquid_entry));
+    memset(liquid_height, 0, sizeof(liquid_height));
+
+    memset(holes, 0, sizeof(holes));
+
+    // Prepare map header
+    map_fileheader map;
+    map.mapMagic = *reinterpret_cast<uint32 const*>(MAP_MAGIC);
+    map.versionMagic = MAP_VERSION_MAGIC;
+    map.buildMagic = build;
+
+    // Get area flags data
+    for (int i = 0; i < ADT_CELLS_PER_GRID; i++)
+        for (int j = 0; j < ADT_CELLS_PER_GRID; j++)
+            area_ids[i][j] = cells->getMCNK(i, j)->areaid;
+
+    //============================================
+    // Try pack area data
+    //============================================
+    bool fullAreaData = false;
+    uint32 areaId = area_ids[0][0];
+    for (auto & area_id : area_ids)
+    {
+        for (int x = 0; x < ADT_CELLS_PER_GRID; ++x)
+        {
+            if (area_id[x] != areaId)
+            {
+                fullAreaData = true;
+                break;
+            }
+        }
+    }
+
+    map.areaMapOffset = sizeof(map);
+    map.areaMapSize   = sizeof(map_areaHeader);
+
+    map_areaHeader areaHeader;
+    areaHeader.fourcc = *reinterpret_cast<uint32 const*>(MAP_AREA_MAGIC);
+    areaHeader.flags = 0;
+    if (fullAreaData)
+    {
+        areaHeader.gridArea = 0;
+        map.areaMapSize += sizeof(area_ids);
+    }
+    else
+    {
+        areaHeader.flags |= MAP_AREA_NO_AREA;
+        areaHeader.gridArea = static_cast<uint16>(areaId);
+    }
+
+    //
+    // Get Height map from grid
+    //
+    for (int i = 0; i < ADT_CELLS_PER_GRID; i++)
+    {
+        for (int j = 0; j < ADT_CELLS_PER_GRID; j++)
+        {
+            adt_MCNK* cell = cells->getMCNK(i, j);
+            if (!cell)
+                continue;
+            // Height values for triangles stored in order:
+            // 1     2     3     4     5     6     7     8     9
+            //    10    11    12    13    14    15    16    17
+            // 18    19    20    21    22    23    24    25    26
+            //    27    28    29    30    31    32    33    34
+            // . . . . . . . .
+            // For better get height values merge it to V9 and V8 map
+            // V9 height map:
+            // 1     2     3     4     5     6     7     8     9
+            // 18    19    20    21    22    23    24    25    26
+            // . . . . . . . .
+            // V8 height map:
+            //    10    11    12    13    14    15    16    17
+            //    27    28    29    30    31    32    33    34
+            // . . . . . . . .
+
+            // Set map height as grid height
+            for (int y = 0; y <= ADT_CELL_SIZE; y++)
+            {
+                int cy = i * ADT_CELL_SIZE + y;
+                for (int x = 0; x <= ADT_CELL_SIZE; x++)
+                {
+                    int cx = j * ADT_CELL_SIZE + x;
+                    V9[cy][cx] = cell->ypos;
+                }
+            }
+            for (int y = 0; y < ADT_CELL_SIZE; y++)
+            {
+                int cy = i * ADT_CELL_SIZE + y;
+                for (int x = 0; x < ADT_CELL_SIZE; x++)
+                {
+                    int cx = j * ADT_CELL_SIZE + x;
+                    V8[cy][cx] = cell->ypos;
+                }
+            }
+            // Get custom height
+            adt_MCVT* v = cell->getMCVT();
+            if (!v)
+                continue;
+            // get V9 height map
+            for (int y = 0; y <= ADT_CELL_SIZE; y++)
+            {
+                int cy = i * ADT_CELL_SIZE + y;
+                for (int x = 0; x <= ADT_CELL_SIZE; x++)
+                {
+                    int cx = j * ADT_CELL_SIZE + x;
+                    V9[cy][cx] += v->height_map[y * (ADT_CELL_SIZE * 2 + 1) + x];
+                }
+            }
+            // get V8 height map
+            for (int y = 0; y < ADT_CELL_SIZE; y++)
+            {
+                int cy = i * ADT_CELL_SIZE + y;
+                for (int x = 0; x < ADT_CELL_SIZE; x++)
+                {
+                    int cx = j * ADT_CELL_SIZE + x;
+                    V8[cy][cx] += v->height_map[y * (ADT_CELL_SIZE * 2 + 1) + ADT_CELL_SIZE + 1 + x];
+                }
+            }
+        }
+    }
+    //============================================
+    // Try pack height data
+    //============================================
+    float maxHeight = -20000;
+    float minHeight =  20000;
+    for (auto & y : V8)
+    {
+        for (int x = 0; x < ADT_GRID_SIZE; x++)
+        {
+            float h = y[x];
+            if (maxHeight < h) maxHeight = h;
+            if (minHeight > h) minHeight = h;
+        }
+    }
+    for (int y = 0; y <= ADT_GRID_SIZE; y++)
+    {
+        for (int x = 0; x <= ADT_GRID_SIZE; x++)
+        {
+            float h = V9[y][x];
+            if (maxHeight < h) maxHeight = h;
+            if (minHeight > h) minHeight = h;
+        }
+    }
+
+    // Check for allow limit minimum height (not store height in deep ochean - allow save some memory)
+    if (CONF_allow_height_limit && minHeight < CONF_use_minHeight)
+    {
+        for (auto & y : V8)
+            for (int x = 0; x < ADT_GRID_SIZE; x++)
+                if (y[x] < CONF_use_minHeight)
+                    y[x] = CONF_use_minHeight;
+        for (int y = 0; y <= ADT_GRID_SIZE; y++)
+            for (int x = 0; x <= ADT_GRID_SIZE; x++)
+                if (V9[y][x] < CONF_use_minHeight)
+                    V9[y][x] = CONF_use_minHeight;
+        if (minHeight < CONF_use_minHeight)
+            minHeight = CONF_use_minHeight;
+        if (maxHeight < CONF_use_minHeight)
+            maxHeight = CONF_use_minHeight;
+    }
+
+    bool hasFlightBox = false;
+    if (adt_MFBO* mfbo = adt.a_grid->getMFBO())
+    {
+        memcpy(flight_box_max, &mfbo->max, sizeof(flight_box_max));
+        memcpy(flight_box_min, &mfbo->min, sizeof(flight_box_min));
+        hasFlightBox = true;
+    }
+
+    map.heightMapOffset = map.areaMapOffset + map.areaMapSize;
+    map.heightMapSize = sizeof(map_heightHeader);
+
+    map_heightHeader heightHeader;
+    heightHeader.fourcc = *reinterpret_cast<uint32 const*>(MAP_HEIGHT_MAGIC);
+    heightHeader.flags = 0;
+    heightHeader.gridHeight    = minHeight;
+    heightHeader.gridMaxHeight = maxHeight;
+
+    if (maxHeight == minHeight)
+        heightHeader.flags |= MAP_HEIGHT_NO_HEIGHT;
+
+    // Not need store if flat surface
+    if (CONF_allow_float_to_int && (maxHeight - minHeight) < CONF_flat_height_delta_limit)
+        heightHeader.flags |= MAP_HEIGHT_NO_HEIGHT;
+
+    if (hasFlightBox)
+    {
+        heightHeader.flags |= MAP_HEIGHT_HAS_FLIGHT_BOUNDS;
+        map.heightMapSize += sizeof(flight_box_max) + sizeof(flight_box_min);
+    }
+
+    // Try store as packed in uint16 or uint8 values
+    if (!(heightHeader.flags & MAP_HEIGHT_NO_HEIGHT))
+    {
+        float step = 0;
+        // Try Store as uint values
+        if (CONF_allow_float_to_int)
+        {
+            float diff = maxHeight - minHeight;
+            if (diff < CONF_float_to_int8_limit)      // As uint8 (max accuracy = CONF_float_to_int8_limit/256)
+            {
+                heightHeader.flags |= MAP_HEIGHT_AS_INT8;
+                step = selectUInt8StepStore(diff);
+            }
+            else if (diff < CONF_float_to_int16_limit) // As uint16 (max accuracy = CONF_float_to_int16_limit/65536)
+            {
+                heightHeader.flags |= MAP_HEIGHT_AS_INT16;
+                step = selectUInt16StepStore(diff);
+            }
+        }
+
+        // Pack it to int values if need
+        if (heightHeader.flags & MAP_HEIGHT_AS_INT8)
+        {
+            for (int y = 0; y < ADT_GRID_SIZE; y++)
+                for (int x = 0; x < ADT_GRID_SIZE; x++)
+                    uint8_V8[y][x] = uint8((V8[y][x] - minHeight) * step + 0.5f);
+            for (int y = 0; y <= ADT_GRID_SIZE; y++)
+                for (int x = 0; x <= ADT_GRID_SIZE; x++)
+                    uint8_V9[y][x] = uint8((V9[y][x] - minHeight) * step + 0.5f);
+            map.heightMapSize += sizeof(uint8_V9) + sizeof(uint8_V8);
+        }
+        else if (heightHeader.flags & MAP_HEIGHT_AS_INT16)
+        {
+            for (int y = 0; y < ADT_GRID_SIZE; y++)
+                for (int x = 0; x < ADT_GRID_SIZE; x++)
+                    uint16_V8[y][x] = uint16((V8[y][x] - minHeight) * step + 0.5f);
+            for (int y = 0; y <= ADT_GRID_SIZE; y++)
+                for (int x = 0; x <= ADT_GRID_SIZE; x++)
+                    uint16_V9[y][x] = uint16((V9[y][x] - minHeight) * step + 0.5f);
+            map.heightMapSize += sizeof(uint16_V9) + sizeof(uint16_V8);
+        }
+        else
+            map.heightMapSize += sizeof(V9) + sizeof(V8);
+    }
+
+    // Get from MCLQ chunk (old)
+    for (int i = 0; i < ADT_CELLS_PER_GRID; i++)
+    {
+        for (int j = 0; j < ADT_CELLS_PER_GRID; j++)
+        {
+            adt_MCNK* cell = cells->getMCNK(i, j);
+            if (!cell)
+                continue;
+
+            adt_MCLQ* liquid = cell->getMCLQ();
+            int count = 0;
+            if (!liquid || cell->sizeMCLQ <= 8)
+                continue;
+
+            for (int y = 0; y < ADT_CELL_SIZE; y++)
+            {
+                int cy = i * ADT_CELL_SIZE + y;
+                for (int x = 0; x < ADT_CELL_SIZE; x++)
+                {
+                    int cx = j * ADT_CELL_SIZE + x;
+                    if (liquid->flags[y][x] != 0x0F)
+                    {
+                        liquid_show[cy][cx] = true;
+                        if (liquid->flags[y][x] & (1 << 7))
+                            liquid_flags[i][j] |= MAP_LIQUID_TYPE_DARK_WATER;
+                        ++count;
+                    }
+                }
+            }
+
+            uint32 c_flag = cell->flags;
+            if (c_flag & (1 << 2))
+            {
+                liquid_entry[i][j] = 1;
+                liquid_flags[i][j] |= MAP_LIQUID_TYPE_WATER;            // water
+            }
+            if (c_flag & (1 << 3))
+            {
+                liquid_entry[i][j] = 2;
+                liquid_flags[i][j] |= MAP_LIQUID_TYPE_OCEAN;            // ocean
+            }
+            if (c_flag & (1 << 4))
+            {
+                liquid_entry[i][j] = 3;
+                liquid_flags[i][j] |= MAP_LIQUID_TYPE_MAGMA;            // magma/slime
+            }
+
+            if (!count && liquid_flags[i][j])
+                fprintf(stderr, "Wrong liquid detect in MCLQ chunk");
+
+            for (int y = 0; y <= ADT_CELL_SIZE; y++)
+            {
+                int cy = i * ADT_CELL_SIZE + y;
+                for (int x = 0; x <= ADT_CELL_SIZE; x++)
+                {
+                    int cx = j * ADT_CELL_SIZE + x;
+                    liquid_height[cy][cx] = liquid->liquid[y][x].height;
+                }
+            }
+        }
+    }
+
+    // Get liquid map for grid (in WOTLK used MH2O chunk)
+    adt_MH2O* h2o = adt.a_grid->getMH2O();
+    if (h2o)
+    {
+        for (int32 i = 0; i < ADT_CELLS_PER_GRID; i++)
+        {
+            for (int32 j = 0; j < ADT_CELLS_PER_GRID; j++)
+            {
+                adt_liquid_instance const* h = h2o->GetLiquidInstance(i,j);
+                if (!h)
+                    continue;
+
+                adt_liquid_attributes attrs = h2o->GetLiquidAttributes(i, j);
+
+                int32 count = 0;
+                uint64 existsMask = h2o->GetLiquidExistsBitmap(h);
+                for (int32 y = 0; y < h->GetHeight(); y++)
+                {
+                    int32 cy = i * ADT_CELL_SIZE + y + h->GetOffsetY();
+                    for (int32 x = 0; x < h->GetWidth(); x++)
+                    {
+                        int32 cx = j * ADT_CELL_SIZE + x + h->GetOffsetX();
+                        if (existsMask & 1)
+                        {
+                            liquid_show[cy][cx] = true;
+                            ++count;
+                        }
+                        existsMask >>= 1;
+                    }
+                }
+
+                liquid_entry[i][j] = h->LiquidType;
+                switch (LiquidTypes.at(h->LiquidType).SoundBank)
+                {
+                    case LIQUID_TYPE_WATER: liquid_flags[i][j] |= MAP_LIQUID_TYPE_WATER; break;
+                    case LIQUID_TYPE_OCEAN: liquid_flags[i][j] |= MAP_LIQUID_TYPE_OCEAN; if (attrs.Deep) liquid_flags[i][j] |= MAP_LIQUID_TYPE_DARK_WATER; break;
+                    case LIQUID_TYPE_MAGMA: liquid_flags[i][j] |= MAP_LIQUID_TYPE_MAGMA; break;
+                    case LIQUID_TYPE_SLIME: liquid_flags[i][j] |= MAP_LIQUID_TYPE_SLIME; break;
+                    default:
+                        printf("\nCan't find Liquid type %u for map %s\nchunk %d,%d\n", h->LiquidType, inputPath.c_str(), i, j);
+                        break;
+                }
+
+                if (!count && liquid_flags[i][j])
+                    printf("Wrong liquid detect in MH2O chunk");
+
+                int32 pos = 0;
+                for (int32 y = 0; y <= h->GetHeight(); y++)
+                {
+                    int cy = i * ADT_CELL_SIZE + y + h->GetOffsetY();
+                    for (int32 x = 0; x <= h->GetWidth(); x++)
+                    {
+                        int32 cx = j * ADT_CELL_SIZE + x + h->GetOffsetX();
+                        liquid_height[cy][cx] = h2o->GetLiquidHeight(h, pos);
+
+                        pos++;
+                    }
+                }
+            }
+        }
+    }
+    //============================================
+    // Pack liquid data
+    //============================================
+    uint16 firstLiquidType = liquid_entry[0][0];
+    uint8 firstLiquidFlag = liquid_flags[0][0];
+    bool fullType = false;
+    for (int y = 0; y < ADT_CELLS_PER_GRID; y++)
+    {
+        for (int x = 0; x < ADT_CELLS_PER_GRID; x++)
+        {
+            if (liquid_entry[y][x] != firstLiquidType || liquid_flags[y][x] != firstLiquidFlag)
+            {
+                fullType = true;
+                y = ADT_CELLS_PER_GRID;
+                break;
+            }
+        }
+    }
+
+    map_liquidHeader liquidHeader;
+
+    // no water data (if all grid have 0 liquid type)
+    if (firstLiquidFlag == 0 && !fullType)
+    {
+        // No liquid data
+        map.liquidMapOffset = 0;
+        map.liquidMapSize   = 0;
+    }
+    else
+    {
+        int minX = 255, minY = 255;
+        int maxX = 0, maxY = 0;
+        maxHeight = -20000;
+        minHeight = 20000;
+        for (int y = 0; y < ADT_GRID_SIZE; y++)
+        {
+            for (int x = 0; x < ADT_GRID_SIZE; x++)
+            {
+                if (liquid_show[y][x])
+                {
+                    if (minX > x) minX = x;
+                    if (maxX < x) maxX = x;
+                    if (minY > y) minY = y;
+                    if (maxY < y) maxY = y;
+                    float h = liquid_height[y][x];
+                    if (maxHeight < h) maxHeight = h;
+                    if (minHeight > h) minHeight = h;
+                }
+                else
+                {
+                    liquid_height[y][x] = CONF_use_minHeight;
+
+                    if (minHeight > CONF_use_minHeight)
+                    {
+                        minHeight = CONF_use_minHeight;
+                    }
+                }
+            }
+        }
+        map.liquidMapOffset = map.heightMapOffset + map.heightMapSize;
+        map.liquidMapSize = sizeof(map_liquidHeader);
+        liquidHeader.fourcc = *(uint32 const*)MAP_LIQUID_MAGIC;
+        liquidHeader.flags = 0;
+        liquidHeader.liquidFlags = 0;
+        liquidHeader.liquidType = 0;
+        liquidHeader.offsetX = minX;
+        liquidHeader.offsetY = minY;
+        liquidHeader.width   = maxX - minX + 1 + 1;
+        liquidHeader.height  = maxY - minY + 1 + 1;
+        liquidHeader.liquidLevel = minHeight;
+
+        if (maxHeight == minHeight)
+            liquidHeader.flags |= MAP_LIQUID_NO_HEIGHT;
+
+        // Not need store if flat surface
+        if (CONF_allow_float_to_int && (maxHeight - minHeight) < CONF_flat_liquid_delta_limit)
+            liquidHeader.flags |= MAP_LIQUID_NO_HEIGHT;
+
+        if (!fullType)
+            liquidHeader.flags |= MAP_LIQUID_NO_TYPE;
+
+        if (liquidHeader.flags & MAP_LIQUID_NO_TYPE)
+        {
+            liquidHeader.liquidFlags = firstLiquidFlag;
+            liquidHeader.liquidType = firstLiquidType;
+        }
+        else
+            map.liquidMapSize += sizeof(liquid_entry) + sizeof(liquid_flags);
+
+        if (!(liquidHeader.flags & MAP_LIQUID_NO_HEIGHT))
+            map.liquidMapSize += sizeof(float) * liquidHeader.width * liquidHeader.height;
+    }
+
+    bool hasHoles = false;
+
+    for (int i = 0; i < ADT_CELLS_PER_GRID; ++i)
+    {
+        for (int j = 0; j < ADT_CELLS_PER_GRID; ++j)
+        {
+            adt_MCNK* cell = cells->getMCNK(i, j);
+            if (!cell)
+                continue;
+            holes[i][j] = cell->holes;
+            if (!hasHoles && cell->holes != 0)
+                hasHoles = true;
+        }
+    }
+
+    if (hasHoles)
+    {
+        if (map.liquidMapOffset)
+            map.holesOffset = map.liquidMapOffset + map.liquidMapSize;
+        else
+            map.holesOffset = map.heightMapOffset + map.heightMapSize;
+
+        map.holesSize = sizeof(holes);
+    }
+    else
+    {
+        map.holesOffset = 0;
+        map.holesSize = 0;
+    }
+
+    // Ok all data prepared - store it
+    FILE* output = fopen(outputPath.c_str(), "wb");
+    if (!output)
+    {
+        printf("Can't create the output file '%s'\n", outputPath.c_str());
+        return false;
+    }
+    fwrite(&map, sizeof(map), 1, output);
+    // Store area data
+    fwrite(&areaHeader, sizeof(areaHeader), 1, output);
+    if (!(areaHeader.flags & MAP_AREA_NO_AREA))
+        fwrite(area_ids, sizeof(area_ids), 1, output);
+
+    // Store height data
+    fwrite(&heightHeader, sizeof(heightHeader), 1, output);
+    if (!(heightHeader.flags & MAP_HEIGHT_NO_HEIGHT))
+    {
+        if (heightHeader.flags & MAP_HEIGHT_AS_INT16)
+        {
+            fwrite(uint16_V9, sizeof(uint16_V9), 1, output);
+            fwrite(uint16_V8, sizeof(uint16_V8), 1, output);
+        }
+        else if (heightHeader.flags & MAP_HEIGHT_AS_INT8)
+        {
+            fwrite(uint8_V9, sizeof(uint8_V9), 1, output);
+            fwrite(uint8_V8, sizeof(uint8_V8), 1, output);
+        }
+        else
+        {
+            fwrite(V9, sizeof(V9), 1, output);
+            fwrite(V8, sizeof(V8), 1, output);
+        }
+    }
+
+    if (heightHeader.flags & MAP_HEIGHT_HAS_FLIGHT_BOUNDS)
+    {
+        fwrite(flight_box_max, sizeof(flight_box_max), 1, output);
+        fwrite(flight_box_min, sizeof(flight_box_min), 1, output);
+    }
+
+    // Store liquid data if need
+    if (map.liquidMapOffset)
+    {
+        fwrite(&liquidHeader, sizeof(liquidHeader), 1, output);
+        if (!(liquidHeader.flags & MAP_LIQUID_NO_TYPE))
+        {
+            fwrite(liquid_entry, sizeof(liquid_entry), 1, output);
+            fwrite(liquid_flags, sizeof(liquid_flags), 1, output);
+        }
+        if (!(liquidHeader.flags & MAP_LIQUID_NO_HEIGHT))
+        {
+            for (int y = 0; y < liquidHeader.height; y++)
+                fwrite(&liquid_height[y + liquidHeader.offsetY][liquidHeader.offsetX], sizeof(float), liquidHeader.width, output);
+        }
+    }
+
+    // store hole data
+    if (hasHoles)
+        fwrite(holes, map.holesSize, 1, output);
+
+    fclose(output);
+
+    return true;
+}
+
+void ConvertADTs(std::vector<ADTConversionJob> const& jobs, uint32 build, uint32 threads, std::function<void()> const& openArchives, std::function<void()> const& closeArchives)
+{
+    if (jobs.empty())
+        return;
+
+    std::atomic<std::size_t> nextJob = 0;
+    std::atomic<std::size_t> doneJobs = 0;
+    std::mutex progressLock;
+    uint32 lastProgress = 0;
+
+    auto worker = [&]()
+    {
+        for (std::size_t i = nextJob++; i < jobs.size(); i = nextJob++)
+        {
+            ConvertADT(jobs[i].InputPath, jobs[i].OutputPath, build);
+
+            // draw progress bar
+            uint32 progress = uint32((100 * ++doneJobs) / jobs.size());
+            std::lock_guard<std::mutex> guard(progressLock);
+            if (progress > lastProgress)
+            {
+                lastProgress = progress;
+                printf("Processing........................%u%%\r", progress);
+                fflush(stdout);
+            }
+        }
+    };
+
+    threads = std::clamp<uint32>(threads, 1, uint32(jobs.size()));
+    if (threads == 1)
+    {
+        // the calling thread already has the archives open
+        worker();
+        return;
+    }
+
+    // libmpq archive handles can not be shared, every thread opens its own
+    std::vector<std::thread> workers;
+    workers.reserve(threads);
+    for (uint32 i = 0; i < threads; ++i)
+    {
+        workers.emplace_back([&]()
+        {
+            openArchives();
+            worker();
+            closeArchives();
+        });
+    }
+
+    for (std::thread& thread : workers)
+        thread.join();
+}
@@ -0,0 +1,56 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef MAP_CONVERTER_H
+#define MAP_CONVERTER_H
+
+#include "Define.h"
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+struct LiquidTypeInfo
+{
+    uint8 SoundBank;
+};
+
+extern std::unordered_map<uint32, LiquidTypeInfo> LiquidTypes;
+
+extern bool  CONF_allow_height_limit;
+extern float CONF_use_minHeight;
+extern bool  CONF_allow_float_to_int;
+extern float CONF_float_to_int8_limit;
+extern float CONF_float_to_int16_limit;
+extern float CONF_flat_height_delta_limit;
+extern float CONF_flat_liquid_delta_limit;
+
+struct ADTConversionJob
+{
+    std::string InputPath;                                  // adt file in the opened MPQ archives
+    std::string OutputPath;                                 // .map file
+};
+
+// Converts one adt file to a .map file
+bool ConvertADT(std::string const& inputPath, std::string const& outputPath, uint32 build);
+
+// Converts all jobs on up to <threads> threads. Worker threads call openArchives before their first
+// job and closeArchives after their last one, a single thread runs on the calling thread and uses its archives.
+// Every job writes its own file, so the output does not depend on the thread count or the job order.
+void ConvertADTs(std::vector<ADTConversionJob> const& jobs, uint32 build, uint32 threads, std::function<void()> const& openArchives, std::function<void()> const& closeArchives);
+
+#endif
@@ -19,7 +19,8 @@
 #include <cstdio>
 #include <deque>
 
-ArchiveSet gOpenArchives;
+// libmpq archive handles can not be shared between threads, every thread opens its own
+thread_local ArchiveSet gOpenArchives;
 
 MPQArchive::MPQArchive(const char* filename)
 {
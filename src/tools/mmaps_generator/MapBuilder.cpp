@@ -67,6 +67,8 @@ namespace MMAP
         m_mapid              (mapid),
         m_totalTiles         (0u),
         m_totalTilesProcessed(0u),
+        m_tileHasher         (config->DataDirPath(), offMeshFilePath),
+        m_tileManifest       ((std::filesystem::path(config->MMapsPath()) / "tiles.manifest").string()),
 
         _cancelationToken    (false)
     {
@@ -208,9 +210,10 @@ namespace MMAP
             m_tileBuilders.push_back(new TileBuilder(this, m_skipLiquid, m_debugOutput));
         }
 
+        std::vector<TileInfo> queuedTiles;
         if (mapID)
         {
-            buildMap(*mapID);
+            buildMap(*mapID, queuedTiles);
         }
         else
         {
@@ -218,10 +221,20 @@ namespace MMAP
             for (TileList::iterator it = m_tiles.begin(); it != m_tiles.end(); ++it)
             {
                 if (!shouldSkipMap(it->m_mapId))
-                    buildMap(it->m_mapId);
+                    buildMap(it->m_mapId, queuedTiles);
             }
         }
 
+        // all threads take their next tile from the same queue, start with the tiles having the most input data
+        // so the last tiles of the run are small ones instead of a continent tile keeping a single thread busy
+        std::stable_sort(queuedTiles.begin(), queuedTiles.end(), [](TileInfo const& left, TileInfo const& right)
+        {
+            return left.m_inputSize > right.m_inputSize;
+        });
+
+        for (TileInfo const& tileInfo : queuedTiles)
+            _queue.Push(tileInfo);
+
         while (!_queue.Empty())
         {
             std::this_thread::sleep_for(std::chrono::milliseconds(1000));
@@ -235,6 +248,8 @@ namespace MMAP
             delete builder;
 
         m_tileBuilders.clear();
+
+        m_tileManifest.save();
     }
 
     /**************************************************************************/
@@ -406,7 +421,8 @@ namespace MMAP
             {
                 printf("[Map %04i] Failed creating navmesh for tile %i,%i !\n", tileInfo.m_mapId, tileInfo.m_tileX, tileInfo.m_tileY);
                 dtFreeNavMesh(navMesh);
-                return;
+                ++m_mapBuilder->m_totalTilesProcessed;
+                continue;
             }
 
             buildTile(tileInfo.m_mapId, tileInfo.m_tileX, tileInfo.m_tileY, navMesh);
@@ -416,7 +432,7 @@ namespace MMAP
     }
 
     /**************************************************************************/
-    void MapBuilder::buildMap(uint32 mapID)
+    void MapBuilder::buildMap(uint32 mapID, std::vector<TileInfo>& queuedTiles)
     {
         std::set<uint32>* tiles = getTileList(mapID);
 
@@ -446,7 +462,8 @@ namespace MMAP
                 tileInfo.m_tileX = tileX;
                 tileInfo.m_tileY = tileY;
                 memcpy(&tileInfo.m_navMeshParams, navMesh->getParams(), sizeof(dtNavMeshParams));
-                _queue.Push(tileInfo);
+                tileInfo.m_inputSize = m_tileHasher.getTileInputSize(mapID, tileX, tileY);
+                queuedTiles.push_back(tileInfo);
             }
 
             dtFreeNavMesh(navMesh);
@@ -456,7 +473,11 @@ namespace MMAP
     /**************************************************************************/
     void TileBuilder::buildTile(uint32 mapID, uint32 tileX, uint32 tileY, dtNavMesh* navMesh)
     {
-        if (shouldSkipTile(mapID, tileX, tileY))
+        const std::string inputHash = m_mapBuilder->m_tileHasher.getTileHash(mapID, tileX, tileY,
+            m_mapBuilder->getConfig().GetConfigForTile(mapID, tileX, tileY).toMMAPTileRecastConfig(),
+            m_terrainBuilder->usesLiquids(), *navMesh->getParams());
+
+        if (shouldSkipTile(mapID, tileX, tileY, inputHash))
         {
             ++m_mapBuilder->m_totalTilesProcessed;
             return;
@@ -464,6 +485,9 @@ namespace MMAP
 
         printf("%u%% [Map %04i] Building tile [%02u,%02u]\n", m_mapBuilder->currentPercentageDone(), mapID, tileX, tileY);
 
+        // inputs changed, a tile left over from the last build must not survive if this one ends up empty
+        std::remove(Acore::StringFormat(TILE_FILE_NAME_FORMAT, m_mapBuilder->getConfig().DataDirPath(), mapID, tileY, tileX).c_str());
+
         MeshData meshData;
 
         // get heightmap data
@@ -475,6 +499,7 @@ namespace MMAP
         // if there is no data, give up now
         if (!meshData.solidVerts.size() && !meshData.liquidVerts.size())
         {
+            m_mapBuilder->m_tileManifest.record(mapID, tileX, tileY, inputHash, false);
             ++m_mapBuilder->m_totalTilesProcessed;
             return;
         }
@@ -490,6 +515,7 @@ namespace MMAP
 
         if (!allVerts.size())
         {
+            m_mapBuilder->m_tileManifest.record(mapID, tileX, tileY, inputHash, false);
             ++m_mapBuilder->m_totalTilesProcessed;
             return;
         }
@@ -501,7 +527,9 @@ namespace MMAP
         m_terrainBuilder->loadOffMeshConnections(mapID, tileX, tileY, meshData, m_mapBuilder->m_offMeshFilePath);
 
         // build navmesh tile
-        buildMoveMapTile(mapID, tileX, tileY, meshData, bmin, bmax, navMesh);
+        TileBuildResult result = buildMoveMapTile(mapID, tileX, tileY, meshData, bmin, bmax, navMesh);
+        if (result != TileBuildResult::Failed)
+            m_mapBuilder->m_tileManifest.record(mapID, tileX, tileY, inputHash, result == TileBuildResult::Written);
 
         ++m_mapBuilder->m_totalTilesProcessed;
     }
@@ -585,9 +613,9 @@ namespace MMAP
     }
 
     /**************************************************************************/
-    void TileBuilder::buildMoveMapTile(uint32 mapID, uint32 tileX, uint32 tileY,
-                                      MeshData& meshData, float bmin[3], float bmax[3],
-                                      dtNavMesh* navMesh)
+    TileBuildResult TileBuilder::buildMoveMapTile(uint32 mapID, uint32 tileX, uint32 tileY,
+                                                 MeshData& meshData, float bmin[3], float bmax[3],
+                                                 dtNavMesh* navMesh)
     {
         // console output
         char tileString[20];
@@ -628,6 +656,7 @@ namespace MMAP
         rcPolyMesh** pmmerge = new rcPolyMesh*[tilesPerMap * tilesPerMap];
         rcPolyMeshDetail** dmmerge = new rcPolyMeshDetail*[tilesPerMap * tilesPerMap];
         int nmerge = 0;
+        bool subTileFailed = false;
 
         // build all tiles
         for (int y = 0; y < tilesPerMap; ++y)
@@ -652,6 +681,7 @@ namespace MMAP
                 if (!tile.solid || !rcCreateHeightfield(m_rcContext, *tile.solid, tileCfg.width, tileCfg.height, tileCfg.bmin, tileCfg.bmax, tileCfg.cs, tileCfg.ch))
                 {
                     printf("%s Failed building heightfield!            \n", tileString);
+                    subTileFailed = true;
                     continue;
                 }
 
@@ -675,6 +705,7 @@ namespace MMAP
                 if (!tile.chf || !rcBuildCompactHeightfield(m_rcContext, tileCfg.walkableHeight, tileCfg.walkableClimb, *tile.solid, *tile.chf))
                 {
                     printf("%s Failed compacting heightfield!            \n", tileString);
+                    subTileFailed = true;
                     continue;
                 }
 
@@ -682,18 +713,21 @@ namespace MMAP
                 if (!rcErodeWalkableArea(m_rcContext, config.walkableRadius, *tile.chf))
                 {
                     printf("%s Failed eroding area!                    \n", tileString);
+                    subTileFailed = true;
                     continue;
                 }
 
                 if (!rcBuildDistanceField(m_rcContext, *tile.chf))
                 {
                     printf("%s Failed building distance field!         \n", tileString);
+                    subTileFailed = true;
                     continue;
                 }
 
                 if (!rcBuildRegions(m_rcContext, *tile.chf, tileCfg.borderSize, tileCfg.minRegionArea, tileCfg.mergeRegionArea))
                 {
                     printf("%s Failed building regions!                \n", tileString);
+                    subTileFailed = true;
                     continue;
                 }
 
@@ -701,6 +735,7 @@ namespace MMAP
                 if (!tile.cset || !rcBuildContours(m_rcContext, *tile.chf, tileCfg.maxSimplificationError, tileCfg.maxEdgeLen, *tile.cset))
                 {
                     printf("%s Failed building contours!               \n", tileString);
+                    subTileFailed = true;
                     continue;
                 }
 
@@ -709,6 +744,7 @@ namespace MMAP
                 if (!tile.pmesh || !rcBuildPolyMesh(m_rcContext, *tile.cset, tileCfg.maxVertsPerPoly, *tile.pmesh))
                 {
                     printf("%s Failed building polymesh!               \n", tileString);
+                    subTileFailed = true;
                     continue;
                 }
 
@@ -716,6 +752,7 @@ namespace MMAP
                 if (!tile.dmesh || !rcBuildPolyMeshDetail(m_rcContext, *tile.pmesh, *tile.chf, tileCfg.detailSampleDist, tileCfg.detailSampleMaxError, *tile.dmesh))
                 {
                     printf("%s Failed building polymesh detail!        \n", tileString);
+                    subTileFailed = true;
                     continue;
                 }
 
@@ -742,7 +779,7 @@ namespace MMAP
             delete[] pmmerge;
             delete[] dmmerge;
             delete[] tiles;
-            return;
+            return TileBuildResult::Failed;
         }
         rcMergePolyMeshes(m_rcContext, pmmerge, nmerge, *iv.polyMesh);
 
@@ -753,7 +790,7 @@ namespace MMAP
             delete[] pmmerge;
             delete[] dmmerge;
             delete[] tiles;
-            return;
+            return TileBuildResult::Failed;
         }
         rcMergePolyMeshDetails(m_rcContext, dmmerge, nmerge, *iv.polyMeshDetail);
 
@@ -806,6 +843,7 @@ namespace MMAP
         // will hold final navmesh
         unsigned char* navData = nullptr;
         int navDataSize = 0;
+        TileBuildResult result = TileBuildResult::Failed;
 
         do
         {
@@ -828,6 +866,7 @@ namespace MMAP
 
                 // message is an annoyance
                 printf("%sNo vertices to build tile!              \n", tileString);
+                result = TileBuildResult::Empty;
                 break;
             }
             if (!params.polyCount || !params.polys)
@@ -835,6 +874,7 @@ namespace MMAP
                 // we have flat tiles with no actual geometry - don't build those, its useless
                 // keep in mind that we do output those into debug info
                 printf("%s No polygons to build on tile!              \n", tileString);
+                result = TileBuildResult::Empty;
                 break;
             }
             if (!params.detailMeshes || !params.detailVerts || !params.detailTris)
@@ -890,6 +930,7 @@ namespace MMAP
             // write data
             fwrite(navData, sizeof(unsigned char), navDataSize, file);
             fclose(file);
+            result = TileBuildResult::Written;
 
             // now that tile is written to disk, we can unload it
             navMesh->removeTile(tileRef, nullptr, nullptr);
@@ -908,6 +949,9 @@ namespace MMAP
             iv.generateObjFile(m_mapBuilder->getConfig().DataDirPath(), mapID, tileX, tileY, meshData);
             iv.writeIV(m_mapBuilder->getConfig().DataDirPath(), mapID, tileX, tileY);
         }
+
+        // a sub tile that failed leaves a hole in the mesh, try again on the next run
+        return subTileFailed ? TileBuildResult::Failed : result;
     }
 
     /**************************************************************************/
@@ -1032,8 +1076,17 @@ namespace MMAP
     }
 
     /**************************************************************************/
-    bool TileBuilder::shouldSkipTile(uint32 mapID, uint32 tileX, uint32 tileY) const
+    bool TileBuilder::shouldSkipTile(uint32 mapID, uint32 tileX, uint32 tileY, const std::string& inputHash) const
     {
+        // tiles without an entry come from a build made before the manifest existed, rebuild them once
+        bool hasTile = false;
+        if (!m_mapBuilder->m_tileManifest.isUpToDate(mapID, tileX, tileY, inputHash, hasTile))
+            return false;
+
+        // same inputs produced no tile last time
+        if (!hasTile)
+            return true;
+
         const std::string fileName = Acore::StringFormat(
             TILE_FILE_NAME_FORMAT,
             m_mapBuilder->getConfig().DataDirPath(),
@@ -27,6 +27,7 @@
 #include "Config.h"
 #include "Optional.h"
 #include "TerrainBuilder.h"
+#include "TileManifest.h"
 
 #include "DetourNavMesh.h"
 #include "PCQueue.h"
@@ -74,12 +75,20 @@ namespace MMAP
 
     struct TileInfo
     {
-        TileInfo() : m_mapId(uint32(-1)), m_tileX(), m_tileY(), m_navMeshParams() {}
+        TileInfo() : m_mapId(uint32(-1)), m_tileX(), m_tileY(), m_navMeshParams(), m_inputSize() {}
 
         uint32 m_mapId;
         uint32 m_tileX;
         uint32 m_tileY;
         dtNavMeshParams m_navMeshParams;
+        uint64 m_inputSize;
+    };
+
+    enum class TileBuildResult
+    {
+        Written,
+        Empty,                                              // nothing walkable, there is no tile file
+        Failed                                              // left out of the manifest, so the next run builds it again
     };
 
     /// @todo: move this to its own file. For now it will stay here to keep the changes to a minimum, especially in the cpp file
@@ -99,15 +108,15 @@ namespace MMAP
 
         void buildTile(uint32 mapID, uint32 tileX, uint32 tileY, dtNavMesh* navMesh);
         // move map building
-        void buildMoveMapTile(uint32 mapID,
-                              uint32 tileX,
-                              uint32 tileY,
-                              MeshData& meshData,
-                              float bmin[3],
-                              float bmax[3],
-                              dtNavMesh* navMesh);
+        TileBuildResult buildMoveMapTile(uint32 mapID,
+                                         uint32 tileX,
+                                         uint32 tileY,
+                                         MeshData& meshData,
+                                         float bmin[3],
+                                         float bmax[3],
+                                         dtNavMesh* navMesh);
 
-        bool shouldSkipTile(uint32 mapID, uint32 tileX, uint32 tileY) const;
+        bool shouldSkipTile(uint32 mapID, uint32 tileX, uint32 tileY, const std::string& inputHash) const;
 
     private:
         bool m_debugOutput;
@@ -140,8 +149,8 @@ namespace MMAP
 
         const Config& getConfig() const { return *m_config; }
     private:
-        // builds all mmap tiles for the specified map id (ignores skip settings)
-        void buildMap(uint32 mapID);
+        // queues all mmap tiles for the specified map id (ignores skip settings)
+        void buildMap(uint32 mapID, std::vector<TileInfo>& queuedTiles);
         // detect maps and tiles
         void discoverTiles();
         std::set<uint32>* getTileList(uint32 mapID);
@@ -184,6 +193,10 @@ namespace MMAP
         // build performance - not really used for now
         rcContext* m_rcContext{nullptr};
 
+        // tiles are only rebuilt when the hash of their inputs differs from the one of their last build
+        TileInputHasher m_tileHasher;
+        TileManifest m_tileManifest;
+
         std::vector<TileBuilder*> m_tileBuilders;
         ProducerConsumerQueue<TileInfo> _queue;
         std::atomic<bool> _cancelationToken;
@@ -0,0 +1,257 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "TileManifest.h"
+#include "BoundingIntervalHierarchy.h"
+#include "CryptoHash.h"
+#include "MapTree.h"
+#include "ModelInstance.h"
+#include "StringFormat.h"
+#include "Util.h"
+#include "VMapDefinitions.h"
+#include "VMapMgr2.h"
+#include <filesystem>
+#include <fstream>
+
+using namespace VMAP;
+
+namespace MMAP
+{
+    static char const* const TERRAIN_FILE_NAME_FORMAT = "{}/{:03}{:02}{:02}.map";
+    static char const* const MISSING_FILE_HASH = "-";
+
+    static uint64 makeTileKey(uint32 mapID, uint32 tileX, uint32 tileY)
+    {
+        return (uint64(mapID) << 32) | (uint64(tileX) << 16) | tileY;
+    }
+
+    TileInputHasher::TileInputHasher(const std::string& dataDirPath, const char* offMeshFilePath) :
+        m_mapsPath((std::filesystem::path(dataDirPath) / "maps").string()),
+        m_vmapsPath((std::filesystem::path(dataDirPath) / "vmaps").string())
+    {
+        if (!offMeshFilePath)
+            return;
+
+        FILE* fp = fopen(offMeshFilePath, "rb");
+        if (!fp)
+            return;
+
+        // same format as TerrainBuilder::loadOffMeshConnections, the raw lines are part of the tile hash
+        char buf[512];
+        while (fgets(buf, sizeof(buf), fp))
+        {
+            float p0[3], p1[3];
+            uint32 mid, tx, ty;
+            float size;
+            if (sscanf(buf, "%u %u,%u (%f %f %f) (%f %f %f) %f", &mid, &tx, &ty,
+                       &p0[0], &p0[1], &p0[2], &p1[0], &p1[1], &p1[2], &size) != 10)
+                continue;
+
+            m_offMeshConnections[makeTileKey(mid, tx, ty)].append(buf);
+        }
+
+        fclose(fp);
+    }
+
+    std::string TileInputHasher::getTileHash(uint32 mapID, uint32 tileX, uint32 tileY,
+                                             const MmapTileRecastConfig& recastConfig, bool usesLiquids,
+                                             const dtNavMeshParams& navMeshParams)
+    {
+        Acore::Crypto::SHA1 hash;
+
+        uint32 const versions[] = { MMAP_MAGIC, MMAP_VERSION, uint32(DT_NAVMESH_VERSION) };
+        uint8 const liquids = usesLiquids ? 1 : 0;
+        hash.UpdateData(reinterpret_cast<uint8 const*>(versions), sizeof(versions));
+        hash.UpdateData(reinterpret_cast<uint8 const*>(&recastConfig), sizeof(recastConfig));
+        hash.UpdateData(&liquids, sizeof(liquids));
+        hash.UpdateData(reinterpret_cast<uint8 const*>(&navMeshParams), sizeof(navMeshParams));
+
+        // terrain, TerrainBuilder::loadMap also reads the borders of the four neighbours
+        static int const neighbours[5][2] = { { 0, 0 }, { 1, 0 }, { -1, 0 }, { 0, 1 }, { 0, -1 } };
+        for (auto const& offset : neighbours)
+        {
+            uint32 x = tileX + offset[0];
+            uint32 y = tileY + offset[1];
+            hash.UpdateData(getFileHash(Acore::StringFormat(TERRAIN_FILE_NAME_FORMAT, m_mapsPath, mapID, y, x)));
+        }
+
+        // vmaps, the map tree with its global models and the tile with the models spawned on it
+        // TerrainBuilder::loadVMap is called with swapped tile coordinates
+        hash.UpdateData(getFileHash(m_vmapsPath + "/" + VMapMgr2::getMapFileName(mapID)));
+        for (const std::string& model : getMapTreeModels(mapID))
+            hash.UpdateData(getFileHash(m_vmapsPath + "/" + model + ".vmo"));
+
+        const std::string tileFileName = m_vmapsPath + "/" + StaticMapTree::getTileFileName(mapID, tileY, tileX);
+        hash.UpdateData(getFileHash(tileFileName));
+
+        std::vector<std::string> tileModels;
+        if (FILE* tileFile = fopen(tileFileName.c_str(), "rb"))
+        {
+            char chunk[8];
+            uint32 count = 0;
+            if (readChunk(tileFile, chunk, VMAP_MAGIC, 8) && fread(&count, sizeof(uint32), 1, tileFile) == 1)
+            {
+                ModelSpawn spawn;
+                uint32 referencedNode;
+                for (uint32 i = 0; i < count && ModelSpawn::readFromFile(tileFile, spawn) && fread(&referencedNode, sizeof(uint32), 1, tileFile) == 1; ++i)
+                    tileModels.push_back(spawn.name);
+            }
+            fclose(tileFile);
+        }
+
+        for (const std::string& model : tileModels)
+            hash.UpdateData(getFileHash(m_vmapsPath + "/" + model + ".vmo"));
+
+        auto offMesh = m_offMeshConnections.find(makeTileKey(mapID, tileX, tileY));
+        if (offMesh != m_offMeshConnections.end())
+            hash.UpdateData(offMesh->second);
+
+        hash.Finalize();
+        return ByteArrayToHexStr(hash.GetDigest());
+    }
+
+    uint64 TileInputHasher::getTileInputSize(uint32 mapID, uint32 tileX, uint32 tileY) const
+    {
+        std::error_code error;
+        uint64 size = 0;
+
+        uintmax_t terrainSize = std::filesystem::file_size(Acore::StringFormat(TERRAIN_FILE_NAME_FORMAT, m_mapsPath, mapID, tileY, tileX), error);
+        if (!error)
+            size += terrainSize;
+
+        uintmax_t vmapSize = std::filesystem::file_size(m_vmapsPath + "/" + StaticMapTree::getTileFileName(mapID, tileY, tileX), error);
+        if (!error)
+            size += vmapSize;
+
+        return size;
+    }
+
+    std::string TileInputHasher::getFileHash(const std::string& path)
+    {
+        {
+            std::lock_guard<std::mutex> guard(m_cacheLock);
+            auto itr = m_fileHashes.find(path);
+            if (itr != m_fileHashes.end())
+                return itr->second;
+        }
+
+        std::string result = MISSING_FILE_HASH;
+        std::ifstream file(path, std::ios::binary);
+        if (file)
+        {
+            Acore::Crypto::SHA1 hash;
+            std::vector<char> buffer(64 * 1024);
+            while (file.read(buffer.data(), buffer.size()) || file.gcount() > 0)
+                hash.UpdateData(reinterpret_cast<uint8 const*>(buffer.data()), std::size_t(file.gcount()));
+
+            hash.Finalize();
+            result = ByteArrayToHexStr(hash.GetDigest());
+        }
+
+        std::lock_guard<std::mutex> guard(m_cacheLock);
+        return m_fileHashes.emplace(path, std::move(result)).first->second;
+    }
+
+    const std::vector<std::string>& TileInputHasher::getMapTreeModels(uint32 mapID)
+    {
+        std::lock_guard<std::mutex> guard(m_cacheLock);
+        auto itr = m_mapTreeModels.find(mapID);
+        if (itr != m_mapTreeModels.end())
+            return itr->second;
+
+        std::vector<std::string>& models = m_mapTreeModels[mapID];
+
+        // global model spawns follow the tree, see StaticMapTree::InitMap
+        FILE* file = fopen((m_vmapsPath + "/" + VMapMgr2::getMapFileName(mapID)).c_str(), "rb");
+        if (!file)
+            return models;
+
+        char chunk[8];
+        char tiled = '\0';
+        BIH tree;
+        if (readChunk(file, chunk, VMAP_MAGIC, 8) && fread(&tiled, sizeof(char), 1, file) == 1 &&
+            readChunk(file, chunk, "NODE", 4) && tree.readFromFile(file) && readChunk(file, chunk, "GOBJ", 4))
+        {
+            ModelSpawn spawn;
+            while (ModelSpawn::readFromFile(file, spawn))
+                models.push_back(spawn.name);
+        }
+
+        fclose(file);
+        return models;
+    }
+
+    TileManifest::TileManifest(std::string path) : m_path(std::move(path))
+    {
+        std::ifstream file(m_path);
+        uint32 mapID, tileX, tileY;
+        Entry entry;
+        while (file >> mapID >> tileX >> tileY >> entry.hash >> entry.hasTile)
+            m_entries[makeTileKey(mapID, tileX, tileY)] = entry;
+
+        m_journal = fopen(m_path.c_str(), "ab");
+    }
+
+    TileManifest::~TileManifest()
+    {
+        if (m_journal)
+            fclose(m_journal);
+    }
+
+    bool TileManifest::isUpToDate(uint32 mapID, uint32 tileX, uint32 tileY, const std::string& hash, bool& hasTile) const
+    {
+        std::lock_guard<std::mutex> guard(m_lock);
+        auto itr = m_entries.find(makeTileKey(mapID, tileX, tileY));
+        if (itr == m_entries.end() || itr->second.hash != hash)
+            return false;
+
+        hasTile = itr->second.hasTile;
+        return true;
+    }
+
+    void TileManifest::record(uint32 mapID, uint32 tileX, uint32 tileY, const std::string& hash, bool hasTile)
+    {
+        std::lock_guard<std::mutex> guard(m_lock);
+        m_entries[makeTileKey(mapID, tileX, tileY)] = { hash, hasTile };
+
+        if (m_journal)
+        {
+            fprintf(m_journal, "%u %u %u %s %u\n", mapID, tileX, tileY, hash.c_str(), hasTile ? 1 : 0);
+            fflush(m_journal);
+        }
+    }
+
+    void TileManifest::save()
+    {
+        std::lock_guard<std::mutex> guard(m_lock);
+        if (m_journal)
+            fclose(m_journal);
+
+        std::string const tempPath = m_path + ".tmp";
+        if (FILE* file = fopen(tempPath.c_str(), "wb"))
+        {
+            for (auto const& [key, entry] : m_entries)
+                fprintf(file, "%u %u %u %s %u\n", uint32(key >> 32), uint32(key >> 16) & 0xFFFF, uint32(key) & 0xFFFF, entry.hash.c_str(), entry.hasTile ? 1 : 0);
+            fclose(file);
+
+            std::error_code error;
+            std::filesystem::rename(tempPath, m_path, error);
+        }
+
+        m_journal = fopen(m_path.c_str(), "ab");
+    }
+}
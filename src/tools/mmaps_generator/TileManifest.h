@@ -0,0 +1,90 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _TILE_MANIFEST_H
+#define _TILE_MANIFEST_H
+
+#include "Define.h"
+#include "DetourNavMesh.h"
+#include "MapDefines.h"
+#include <cstdio>
+#include <map>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace MMAP
+{
+    // hashes everything a navmesh tile is built from: terrain of the tile and its neighbours,
+    // vmap spawns and their models, off mesh connections and the recast parameters
+    class TileInputHasher
+    {
+    public:
+        TileInputHasher(const std::string& dataDirPath, const char* offMeshFilePath);
+
+        std::string getTileHash(uint32 mapID, uint32 tileX, uint32 tileY,
+                                const MmapTileRecastConfig& recastConfig, bool usesLiquids,
+                                const dtNavMeshParams& navMeshParams);
+
+        // sum of the terrain and vmap tile file sizes, used to build the expensive tiles first
+        uint64 getTileInputSize(uint32 mapID, uint32 tileX, uint32 tileY) const;
+
+    private:
+        // file contents are cached, a terrain file is part of five tiles and models are shared by many tiles
+        std::string getFileHash(const std::string& path);
+        const std::vector<std::string>& getMapTreeModels(uint32 mapID);
+
+        std::string m_mapsPath;
+        std::string m_vmapsPath;
+        std::unordered_map<uint64, std::string> m_offMeshConnections;
+
+        std::mutex m_cacheLock;
+        std::unordered_map<std::string, std::string> m_fileHashes;
+        std::unordered_map<uint32, std::vector<std::string>> m_mapTreeModels;
+    };
+
+    // input hashes of the tiles built by the previous runs, one "map x y hash hasTile" line per tile
+    // new entries are appended as soon as a tile is done so an interrupted run keeps its progress
+    class TileManifest
+    {
+    public:
+        explicit TileManifest(std::string path);
+        ~TileManifest();
+
+        // true if the tile was built from the same inputs, hasTile tells if that build wrote a tile file
+        bool isUpToDate(uint32 mapID, uint32 tileX, uint32 tileY, const std::string& hash, bool& hasTile) const;
+        void record(uint32 mapID, uint32 tileX, uint32 tileY, const std::string& hash, bool hasTile);
+
+        // rewrites the file with a single line per tile
+        void save();
+
+    private:
+        struct Entry
+        {
+            std::string hash;
+            bool hasTile;
+        };
+
+        std::string m_path;
+        mutable std::mutex m_lock;
+        std::map<uint64, Entry> m_entries;
+        FILE* m_journal{nullptr};
+    };
+}
+
+#endif